@@ -0,0 +1,14 @@
+#!/usr/bin/bash
+#
+# emblem-picker-test-run.sh
+#
+
+gcc -pedantic -Wall -Wextra -Winline -DGNUISANCE_BUILD_FLAG_MANUAL_ENVIRONMENT \
+	-I../../src -I../../src/widgets/flow `pkg-config --cflags gtk4` \
+	`pkg-config --cflags libadwaita-1` `pkg-config --libs gtk4` \
+	`pkg-config --libs libadwaita-1` -lm -o '/tmp/emblem-picker-test' \
+	../../src/widgets/flow/gnui-flow.c \
+	../../src/widgets/emblem-picker/gnui-emblem-backend.c \
+	../../src/widgets/emblem-picker/gnui-emblem-picker.c \
+	emblem-picker-test.c && \
+'/tmp/emblem-picker-test' "${@}" && rm '/tmp/emblem-picker-test'
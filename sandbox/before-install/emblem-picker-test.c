@@ -0,0 +1,140 @@
+/*  -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/*  Please make sure that the TAB width in your editor is set to 4 spaces  */
+
+
+#include <gtk/gtk.h>
+#include <adwaita.h>
+#include "../../src/widgets/emblem-picker/gnui-emblem-picker.h"
+
+
+static void on_save_finished (
+	GObject * const source_object,
+	GAsyncResult * const result,
+	const gpointer v_counts
+) {
+
+	gsize * const counts = v_counts;
+
+	g_assert_true(
+		gnui_emblem_picker_save_finish(
+			GNUI_EMBLEM_PICKER(source_object),
+			result,
+			counts,
+			counts + 1,
+			counts + 2,
+			NULL
+		)
+	);
+
+	counts[3] = true;
+
+}
+
+
+static void test_save_trailing_noaction (void) {
+
+	static const gchar * const important[] = { "emblem-important", NULL };
+
+	GnuiEmblemBackend * const backend = gnui_emblem_backend_memory_new();
+	GFile * const needs_write = g_file_new_for_path("/gnuisance-test/a");
+	GList * files = NULL;
+	gsize counts[4] = { 0, 0, 0, false };
+	gchar ** emblems;
+
+	/*  Only the first file needs a write: the save must not lose it when
+		the last files of the batch need no writes  */
+
+	files = g_list_append(files, needs_write);
+
+	for (guint idx = 0; idx < 3; idx++) {
+
+		gchar * const path = g_strdup_printf("/gnuisance-test/b%u", idx);
+		GFile * const location = g_file_new_for_path(path);
+
+		g_free(path);
+
+		gnui_emblem_backend_memory_set_emblems(
+			GNUI_EMBLEM_BACKEND_MEMORY(backend),
+			location,
+			important
+		);
+
+		files = g_list_append(files, location);
+
+	}
+
+	GnuiEmblemPicker * const picker =
+		GNUI_EMBLEM_PICKER(
+			g_object_ref_sink(gnui_emblem_picker_new(NULL, false, NULL))
+		);
+
+	gnui_emblem_picker_set_backend(picker, backend);
+	gnui_emblem_picker_set_mapped_files(picker, files);
+
+	while (gnui_emblem_picker_get_loading(picker)) {
+
+		g_main_context_iteration(NULL, true);
+
+	}
+
+	g_assert_cmpuint(
+		gnui_emblem_picker_set_emblem_states(
+			picker,
+			important,
+			GNUI_EMBLEM_STATE_SELECTED,
+			true
+		),
+		==,
+		1
+	);
+
+	gnui_emblem_picker_save_async(
+		picker,
+		NULL,
+		NULL,
+		GNUI_EMBLEM_PICKER_SAVE_FLAG_NONE,
+		NULL,
+		on_save_finished,
+		counts
+	);
+
+	while (!counts[3]) {
+
+		g_main_context_iteration(NULL, true);
+
+	}
+
+	g_assert_cmpuint(counts[0], ==, 1);
+	g_assert_cmpuint(counts[1], ==, 0);
+	g_assert_cmpuint(counts[2], ==, 3);
+
+	emblems = gnui_emblem_backend_memory_get_emblems(
+		GNUI_EMBLEM_BACKEND_MEMORY(backend),
+		needs_write
+	);
+
+	g_assert_cmpstrv(emblems, important);
+	g_strfreev(emblems);
+	g_object_unref(picker);
+	g_list_free_full(files, g_object_unref);
+	g_object_unref(backend);
+
+}
+
+
+int main (
+	int argc,
+	char ** argv
+) {
+
+	gtk_test_init(&argc, &argv, NULL);
+	adw_init();
+
+	g_test_add_func(
+		"/emblem-picker/save/trailing-noaction",
+		test_save_trailing_noaction
+	);
+
+	return g_test_run();
+
+}
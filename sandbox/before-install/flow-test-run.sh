@@ -0,0 +1,10 @@
+#!/usr/bin/bash
+#
+# flow-test-run.sh
+#
+
+gcc -lm -Wall -Wextra -Winline -pedantic `pkg-config --cflags gtk4` \
+	`pkg-config --libs gtk4` -DGNUISANCE_BUILD_FLAG_MANUAL_ENVIRONMENT \
+	-I../../src -I../../src/widgets/flow -o '/tmp/flow-test' \
+	../../src/widgets/flow/gnui-flow.c flow-test.c && \
+'/tmp/flow-test' "${@}" && rm '/tmp/flow-test'
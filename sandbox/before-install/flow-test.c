@@ -0,0 +1,157 @@
+/*  -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/*  Please make sure that the TAB width in your editor is set to 4 spaces  */
+
+
+#include <gtk/gtk.h>
+#include "../../src/widgets/flow/gnui-flow.h"
+
+
+#define N_CHILDREN 10
+
+
+/*  A widget that counts how many times it gets measured  */
+
+G_DECLARE_FINAL_TYPE(CountingBox, counting_box, COUNTING, BOX, GtkWidget)
+
+struct _CountingBox {
+	GtkWidget parent_instance;
+	gint width;
+};
+
+G_DEFINE_TYPE(CountingBox, counting_box, GTK_TYPE_WIDGET)
+
+static guint n_measures;
+
+
+static void counting_box_measure (
+	GtkWidget * const widget,
+	const GtkOrientation orientation,
+	const gint for_size G_GNUC_UNUSED,
+	gint * const minimum,
+	gint * const natural,
+	gint * const minimum_baseline G_GNUC_UNUSED,
+	gint * const natural_baseline G_GNUC_UNUSED
+) {
+
+	n_measures++;
+
+	*minimum = *natural =
+		orientation == GTK_ORIENTATION_HORIZONTAL ?
+			COUNTING_BOX(widget)->width
+		:
+			20;
+
+}
+
+
+static void counting_box_class_init (
+	CountingBoxClass * const klass
+) {
+
+	GTK_WIDGET_CLASS(klass)->measure = counting_box_measure;
+
+}
+
+
+static void counting_box_init (
+	CountingBox * const self
+) {
+
+	self->width = 50;
+
+}
+
+
+static gint resize_flow (
+	GtkWidget * const flow,
+	const gint width
+) {
+
+	gint height;
+
+	gtk_widget_measure(
+		flow,
+		GTK_ORIENTATION_HORIZONTAL,
+		-1,
+		NULL,
+		NULL,
+		NULL,
+		NULL
+	);
+
+	gtk_widget_measure(
+		flow,
+		GTK_ORIENTATION_VERTICAL,
+		width,
+		NULL,
+		&height,
+		NULL,
+		NULL
+	);
+
+	gtk_widget_size_allocate(
+		flow,
+		&(GtkAllocation) { .width = width, .height = height },
+		-1
+	);
+
+	return height;
+
+}
+
+
+static void test_measure_cache (void) {
+
+	GtkWidget * const flow = g_object_ref_sink(gnui_flow_new());
+	GtkWidget * children[N_CHILDREN];
+
+	for (guint idx = 0; idx < N_CHILDREN; idx++) {
+
+		children[idx] = g_object_new(counting_box_get_type(), NULL);
+		gnui_flow_append(GNUI_FLOW(flow), children[idx]);
+
+	}
+
+	n_measures = 0;
+	resize_flow(flow, 300);
+
+	const guint n_first_measures = n_measures;
+
+	g_assert_cmpuint(n_first_measures, >=, N_CHILDREN * 2);
+
+	/*  Two resizes: nothing has changed in the children  */
+
+	resize_flow(flow, 200);
+	resize_flow(flow, 400);
+	g_assert_cmpuint(n_measures, ==, n_first_measures);
+
+	/*  A child that changes its size is measured again  */
+
+	const gint old_height = resize_flow(flow, 300);
+
+	COUNTING_BOX(children[0])->width = 400;
+	gtk_widget_queue_resize(children[0]);
+
+	g_assert_cmpint(resize_flow(flow, 300), >, old_height);
+	g_assert_cmpuint(n_measures, >, n_first_measures);
+
+	g_object_unref(flow);
+
+}
+
+
+int main (
+	int argc,
+	char ** argv
+) {
+
+	gtk_test_init(&argc, &argv, NULL);
+
+	g_test_add_func(
+		"/flow/measure/cache-survives-resizes",
+		test_measure_cache
+	);
+
+	return g_test_run();
+
+}
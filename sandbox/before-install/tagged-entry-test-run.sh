@@ -0,0 +1,12 @@
+#!/usr/bin/bash
+#
+# tagged-entry-test-run.sh
+#
+
+gcc -lm -Wall -Wextra -Winline -pedantic `pkg-config --cflags gtk4` \
+	`pkg-config --libs gtk4` -I../../src  -I../../src/widgets/flow \
+	-DGNUISANCE_BUILD_FLAG_MANUAL_ENVIRONMENT -o '/tmp/tagged-entry-test' \
+	../../src/widgets/flow/gnui-flow.c \
+	../../src/widgets/tagged-entry/gnui-tagged-entry.c \
+	tagged-entry-test.c && \
+'/tmp/tagged-entry-test' "${@}" && rm '/tmp/tagged-entry-test'
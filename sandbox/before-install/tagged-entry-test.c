@@ -0,0 +1,119 @@
+/*  -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/*  Please make sure that the TAB width in your editor is set to 4 spaces  */
+
+
+#include <gtk/gtk.h>
+#include "../../src/widgets/tagged-entry/gnui-tagged-entry.h"
+
+
+static gboolean case_insensitive_match (
+	const gchar * const entry_tag,
+	const gchar * const other_tag,
+	const gpointer user_data G_GNUC_UNUSED
+) {
+
+	return !g_ascii_strcasecmp(entry_tag, other_tag);
+
+}
+
+
+static guint case_insensitive_hash (
+	const gchar * const tag,
+	const gpointer user_data G_GNUC_UNUSED
+) {
+
+	gchar * const folded = g_ascii_strdown(tag, -1);
+	const guint hash = g_str_hash(folded);
+
+	g_free(folded);
+	return hash;
+
+}
+
+
+static void assert_tags (
+	GnuiTaggedEntry * const tagged_entry,
+	const gchar * const * const expected
+) {
+
+	const gchar * const * const tags =
+		gnui_tagged_entry_get_tags(tagged_entry);
+
+	g_assert_nonnull(tags);
+	g_assert_cmpstrv(tags, expected);
+
+}
+
+
+static void test_populate_dedup (
+	gconstpointer const v_with_hash
+) {
+
+	GnuiTaggedEntry * const tagged_entry =
+		GNUI_TAGGED_ENTRY(g_object_ref_sink(gnui_tagged_entry_new()));
+
+	gnui_tagged_entry_set_match_function(tagged_entry, case_insensitive_match);
+
+	if (GPOINTER_TO_INT(v_with_hash)) {
+
+		gnui_tagged_entry_set_hash_function(
+			tagged_entry,
+			case_insensitive_hash
+		);
+
+	}
+
+	/*  Duplicates within the input are dropped by the match function  */
+
+	gnui_tagged_entry_populate_strv(
+		tagged_entry,
+		(const gchar *[]) { "Foo", "foo", "Bar", "BAR", "fOO", NULL },
+		false
+	);
+
+	assert_tags(tagged_entry, (const gchar *[]) { "Foo", "Bar", NULL });
+
+	/*  Tags that are already present are kept as they are  */
+
+	gnui_tagged_entry_populate_strv(
+		tagged_entry,
+		(const gchar *[]) { "bar", "Baz", "BAZ", NULL },
+		false
+	);
+
+	assert_tags(tagged_entry, (const gchar *[]) { "Bar", "Baz", NULL });
+
+	/*  The bulk path agrees with the lookups of the single-tag functions  */
+
+	g_assert_true(gnui_tagged_entry_has_tag(tagged_entry, "baz"));
+	g_assert_true(gnui_tagged_entry_remove_tag(tagged_entry, "BAR"));
+	assert_tags(tagged_entry, (const gchar *[]) { "Baz", NULL });
+
+	g_object_unref(tagged_entry);
+
+}
+
+
+int main (
+	int argc,
+	char ** argv
+) {
+
+	gtk_test_init(&argc, &argv, NULL);
+
+	g_test_add_data_func(
+		"/tagged-entry/populate/dedup-with-match-function",
+		GINT_TO_POINTER(false),
+		test_populate_dedup
+	);
+
+	g_test_add_data_func(
+		"/tagged-entry/populate/dedup-with-match-and-hash-functions",
+		GINT_TO_POINTER(true),
+		test_populate_dedup
+	);
+
+	return g_test_run();
+
+}
+
@@ -31,6 +31,7 @@
 
 #include <gnuisance/gnui-definitions.h>
 #include <gnuisance/gnui-environment.h>
+#include <gnuisance/gnui-emblem-backend.h>
 #include <gnuisance/gnui-emblem-picker.h>
 #include <gnuisance/gnui-flow.h>
 #include <gnuisance/gnui-tagged-entry.h>
@@ -0,0 +1,671 @@
+/*  -*- Mode: C; indent-tabs-mode: t; c-basic-offset: 4; tab-width: 4 -*-  */
+/*  Please make sure that the TAB width in your editor is set to 4 spaces  */
+
+/*\
+|*|
+|*| gnui-emblem-backend.c
+|*|
+|*| https://github.com/madmurphy/libgnuisance
+|*|
+|*| Copyright (C) 2022 <madmurphy333@gmail.com>
+|*|
+|*| **libgnuisance** is free software: you can redistribute it and/or modify it
+|*| under the terms of the GNU General Public License as published by the Free
+|*| Software Foundation, either version 3 of the License, or (at your option)
+|*| any later version.
+|*|
+|*| **libgnuisance** is distributed in the hope that it will be useful, but
+|*| WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+|*| or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+|*| more details.
+|*|
+|*| You should have received a copy of the GNU General Public License along
+|*| with this program. If not, see <http://www.gnu.org/licenses/>.
+|*|
+\*/
+
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gio/gio.h>
+#include "gnui-emblem-backend.h"
+
+
+
+/*\
+|*|
+|*| LOCAL DEFINITIONS
+|*|
+\*/
+
+
+#ifndef G_FILE_ATTRIBUTE_METADATA_EMBLEMS
+/**
+
+    G_FILE_ATTRIBUTE_METADATA_EMBLEMS:
+
+    The attribute string for emblems
+
+**/
+#define G_FILE_ATTRIBUTE_METADATA_EMBLEMS "metadata::emblems"
+#endif
+
+
+
+/*\
+|*|
+|*| GLOBAL TYPES AND VARIABLES
+|*|
+\*/
+
+
+/**
+
+    GnuiEmblemBackendGio:
+
+    The GIO emblem backend `struct`
+
+**/
+struct _GnuiEmblemBackendGio {
+	GObject parent_instance;
+};
+
+
+/**
+
+    GnuiEmblemBackendMemory:
+
+    The in-memory emblem backend `struct`
+
+    The `store` member maps each `GFile` to its `NULL`-terminated array of
+    emblems and is protected by `lock`.
+
+**/
+struct _GnuiEmblemBackendMemory {
+	GObject parent_instance;
+	GHashTable * store;
+	GMutex lock;
+	guint n_writes;
+};
+
+
+static void gnui_emblem_backend_gio_backend_init (
+	GnuiEmblemBackendInterface * const iface
+);
+
+
+static void gnui_emblem_backend_memory_backend_init (
+	GnuiEmblemBackendInterface * const iface
+);
+
+
+G_DEFINE_INTERFACE(
+	GnuiEmblemBackend,
+	gnui_emblem_backend,
+	G_TYPE_OBJECT
+)
+
+
+G_DEFINE_FINAL_TYPE_WITH_CODE(
+	GnuiEmblemBackendGio,
+	gnui_emblem_backend_gio,
+	G_TYPE_OBJECT,
+	G_IMPLEMENT_INTERFACE(
+		GNUI_TYPE_EMBLEM_BACKEND,
+		gnui_emblem_backend_gio_backend_init
+	)
+)
+
+
+G_DEFINE_FINAL_TYPE_WITH_CODE(
+	GnuiEmblemBackendMemory,
+	gnui_emblem_backend_memory,
+	G_TYPE_OBJECT,
+	G_IMPLEMENT_INTERFACE(
+		GNUI_TYPE_EMBLEM_BACKEND,
+		gnui_emblem_backend_memory_backend_init
+	)
+)
+
+
+
+/*\
+|*|
+|*| PRIVATE FUNCTIONS
+|*|
+\*/
+
+
+/*  Interface  */
+
+
+/**
+
+    gnui_emblem_backend_default_init:
+    @iface:     (auto) (unused): The emblem backend interface
+
+    The default init function of the emblem backend interface
+
+**/
+static void gnui_emblem_backend_default_init (
+	GnuiEmblemBackendInterface * const iface G_GNUC_UNUSED
+) {
+
+}
+
+
+/*  GIO backend  */
+
+
+/**
+
+    gnui_emblem_backend_gio_read_batch:
+    @self:          (auto) (unused): The GIO emblem backend
+    @locations:     (auto) (not nullable): The files to read
+    @n_files:       (auto): The number of files in @locations
+    @emblems:       (auto) (out caller-allocates): The emblems of each file
+    @errors:        (auto) (out caller-allocates): The error of each file
+    @cancellable:   (auto) (nullable): A `GCancellable`
+
+    Class handler for the #GnuiEmblemBackendInterface.read_batch() method on
+    the GIO emblem backend instance
+
+**/
+static void gnui_emblem_backend_gio_read_batch (
+	GnuiEmblemBackend * const self G_GNUC_UNUSED,
+	GFile * const * const locations,
+	const gsize n_files,
+	gchar *** const emblems,
+	GError ** const errors,
+	GCancellable * const cancellable
+) {
+
+	GFileInfo * finfo;
+
+	for (gsize idx = 0; idx < n_files; idx++) {
+
+		if (
+			!(finfo = g_file_query_info(
+				locations[idx],
+				G_FILE_ATTRIBUTE_METADATA_EMBLEMS,
+				G_FILE_QUERY_INFO_NONE,
+				cancellable,
+				errors + idx
+			))
+		) {
+
+			continue;
+
+		}
+
+		emblems[idx] = g_strdupv(
+			g_file_info_get_attribute_stringv(
+				finfo,
+				G_FILE_ATTRIBUTE_METADATA_EMBLEMS
+			)
+		);
+
+		g_object_unref(finfo);
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_backend_gio_write_batch:
+    @self:          (auto) (unused): The GIO emblem backend
+    @locations:     (auto) (not nullable): The files to write
+    @emblems:       (auto) (not nullable): The emblems of each file
+    @n_files:       (auto): The number of files in @locations
+    @errors:        (auto) (out caller-allocates): The error of each file
+    @cancellable:   (auto) (nullable): A `GCancellable`
+
+    Class handler for the #GnuiEmblemBackendInterface.write_batch() method on
+    the GIO emblem backend instance
+
+**/
+static void gnui_emblem_backend_gio_write_batch (
+	GnuiEmblemBackend * const self G_GNUC_UNUSED,
+	GFile * const * const locations,
+	const gchar * const * const * const emblems,
+	const gsize n_files,
+	GError ** const errors,
+	GCancellable * const cancellable
+) {
+
+	for (gsize idx = 0; idx < n_files; idx++) {
+
+		g_file_set_attribute(
+			locations[idx],
+			G_FILE_ATTRIBUTE_METADATA_EMBLEMS,
+			emblems[idx] ?
+				G_FILE_ATTRIBUTE_TYPE_STRINGV
+			:
+				G_FILE_ATTRIBUTE_TYPE_INVALID,
+			(gpointer) emblems[idx],
+			G_FILE_QUERY_INFO_NONE,
+			cancellable,
+			errors + idx
+		);
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_backend_gio_backend_init:
+    @iface:     (auto) (not nullable): The GIO backend's emblem backend
+                interface
+
+    The init function of the GIO backend's emblem backend interface
+
+**/
+static void gnui_emblem_backend_gio_backend_init (
+	GnuiEmblemBackendInterface * const iface
+) {
+
+	iface->read_batch = gnui_emblem_backend_gio_read_batch;
+	iface->write_batch = gnui_emblem_backend_gio_write_batch;
+
+}
+
+
+/**
+
+    gnui_emblem_backend_gio_class_init:
+    @klass:     (auto) (unused): The GIO emblem backend class
+
+    The init function of the GIO emblem backend class
+
+**/
+static void gnui_emblem_backend_gio_class_init (
+	GnuiEmblemBackendGioClass * const klass G_GNUC_UNUSED
+) {
+
+}
+
+
+/**
+
+    gnui_emblem_backend_gio_init:
+    @self:      (auto) (unused): The newly allocated GIO emblem backend
+
+    The init function of the GIO emblem backend instance
+
+**/
+static void gnui_emblem_backend_gio_init (
+	GnuiEmblemBackendGio * const self G_GNUC_UNUSED
+) {
+
+}
+
+
+/*  In-memory backend  */
+
+
+/**
+
+    gnui_emblem_backend_memory_read_batch:
+    @self:          (auto) (not nullable): The in-memory emblem backend
+    @locations:     (auto) (not nullable): The files to read
+    @n_files:       (auto): The number of files in @locations
+    @emblems:       (auto) (out caller-allocates): The emblems of each file
+    @errors:        (auto) (out caller-allocates): The error of each file
+    @cancellable:   (auto) (nullable): A `GCancellable`
+
+    Class handler for the #GnuiEmblemBackendInterface.read_batch() method on
+    the in-memory emblem backend instance
+
+**/
+static void gnui_emblem_backend_memory_read_batch (
+	GnuiEmblemBackend * const self,
+	GFile * const * const locations,
+	const gsize n_files,
+	gchar *** const emblems,
+	GError ** const errors,
+	GCancellable * const cancellable
+) {
+
+	GnuiEmblemBackendMemory * const backend = GNUI_EMBLEM_BACKEND_MEMORY(self);
+
+	if (g_cancellable_set_error_if_cancelled(cancellable, errors)) {
+
+		for (gsize idx = 1; idx < n_files; idx++) {
+
+			errors[idx] = g_error_copy(errors[0]);
+
+		}
+
+		return;
+
+	}
+
+	g_mutex_lock(&backend->lock);
+
+	for (gsize idx = 0; idx < n_files; idx++) {
+
+		emblems[idx] = g_strdupv(
+			g_hash_table_lookup(backend->store, locations[idx])
+		);
+
+	}
+
+	g_mutex_unlock(&backend->lock);
+
+}
+
+
+/**
+
+    gnui_emblem_backend_memory_write_batch:
+    @self:          (auto) (not nullable): The in-memory emblem backend
+    @locations:     (auto) (not nullable): The files to write
+    @emblems:       (auto) (not nullable): The emblems of each file
+    @n_files:       (auto): The number of files in @locations
+    @errors:        (auto) (out caller-allocates): The error of each file
+    @cancellable:   (auto) (nullable): A `GCancellable`
+
+    Class handler for the #GnuiEmblemBackendInterface.write_batch() method on
+    the in-memory emblem backend instance
+
+    The whole batch is committed at once.
+
+**/
+static void gnui_emblem_backend_memory_write_batch (
+	GnuiEmblemBackend * const self,
+	GFile * const * const locations,
+	const gchar * const * const * const emblems,
+	const gsize n_files,
+	GError ** const errors,
+	GCancellable * const cancellable
+) {
+
+	GnuiEmblemBackendMemory * const backend = GNUI_EMBLEM_BACKEND_MEMORY(self);
+
+	if (g_cancellable_set_error_if_cancelled(cancellable, errors)) {
+
+		for (gsize idx = 1; idx < n_files; idx++) {
+
+			errors[idx] = g_error_copy(errors[0]);
+
+		}
+
+		return;
+
+	}
+
+	g_mutex_lock(&backend->lock);
+
+	for (gsize idx = 0; idx < n_files; idx++) {
+
+		if (emblems[idx] && *emblems[idx]) {
+
+			g_hash_table_replace(
+				backend->store,
+				g_object_ref(locations[idx]),
+				g_strdupv((gchar **) emblems[idx])
+			);
+
+		} else {
+
+			g_hash_table_remove(backend->store, locations[idx]);
+
+		}
+
+	}
+
+	backend->n_writes++;
+	g_mutex_unlock(&backend->lock);
+
+}
+
+
+/**
+
+    gnui_emblem_backend_memory_backend_init:
+    @iface:     (auto) (not nullable): The in-memory backend's emblem backend
+                interface
+
+    The init function of the in-memory backend's emblem backend interface
+
+**/
+static void gnui_emblem_backend_memory_backend_init (
+	GnuiEmblemBackendInterface * const iface
+) {
+
+	iface->read_batch = gnui_emblem_backend_memory_read_batch;
+	iface->write_batch = gnui_emblem_backend_memory_write_batch;
+
+}
+
+
+/**
+
+    gnui_emblem_backend_memory_finalize:
+    @object:    (auto) (not nullable): The in-memory emblem backend passed as
+                `GObject`
+
+    Class handler for the #Object.finalize() method on the in-memory emblem
+    backend instance
+
+**/
+static void gnui_emblem_backend_memory_finalize (
+	GObject * const object
+) {
+
+	GnuiEmblemBackendMemory * const self = GNUI_EMBLEM_BACKEND_MEMORY(object);
+
+	g_hash_table_unref(self->store);
+	g_mutex_clear(&self->lock);
+	G_OBJECT_CLASS(gnui_emblem_backend_memory_parent_class)->finalize(object);
+
+}
+
+
+/**
+
+    gnui_emblem_backend_memory_class_init:
+    @klass:     (auto) (not nullable): The in-memory emblem backend class
+
+    The init function of the in-memory emblem backend class
+
+**/
+static void gnui_emblem_backend_memory_class_init (
+	GnuiEmblemBackendMemoryClass * const klass
+) {
+
+	G_OBJECT_CLASS(klass)->finalize = gnui_emblem_backend_memory_finalize;
+
+}
+
+
+/**
+
+    gnui_emblem_backend_memory_init:
+    @self:      (auto) (not nullable): The newly allocated in-memory emblem
+                backend
+
+    The init function of the in-memory emblem backend instance
+
+**/
+static void gnui_emblem_backend_memory_init (
+	GnuiEmblemBackendMemory * const self
+) {
+
+	self->store = g_hash_table_new_full(
+		(GHashFunc) g_file_hash,
+		(GEqualFunc) g_file_equal,
+		g_object_unref,
+		(GDestroyNotify) g_strfreev
+	);
+
+	g_mutex_init(&self->lock);
+	self->n_writes = 0;
+
+}
+
+
+
+/*\
+|*|
+|*| PUBLIC FUNCTIONS
+|*|
+|*| (See the public header for the documentation)
+|*|
+\*/
+
+
+void gnui_emblem_backend_read_batch (
+	GnuiEmblemBackend * const self,
+	GFile * const * const locations,
+	const gsize n_files,
+	gchar *** const emblems,
+	GError ** const errors,
+	GCancellable * const cancellable
+) {
+
+	g_return_if_fail(GNUI_IS_EMBLEM_BACKEND(self));
+	g_return_if_fail(locations != NULL || !n_files);
+
+	GNUI_EMBLEM_BACKEND_GET_IFACE(self)->read_batch(
+		self,
+		locations,
+		n_files,
+		emblems,
+		errors,
+		cancellable
+	);
+
+}
+
+
+void gnui_emblem_backend_write_batch (
+	GnuiEmblemBackend * const self,
+	GFile * const * const locations,
+	const gchar * const * const * const emblems,
+	const gsize n_files,
+	GError ** const errors,
+	GCancellable * const cancellable
+) {
+
+	g_return_if_fail(GNUI_IS_EMBLEM_BACKEND(self));
+	g_return_if_fail(locations != NULL || !n_files);
+
+	GNUI_EMBLEM_BACKEND_GET_IFACE(self)->write_batch(
+		self,
+		locations,
+		emblems,
+		n_files,
+		errors,
+		cancellable
+	);
+
+}
+
+
+GnuiEmblemBackend * gnui_emblem_backend_get_default (void) {
+
+	static GnuiEmblemBackend * default_backend;
+
+	if (g_once_init_enter(&default_backend)) {
+
+		g_once_init_leave(&default_backend, gnui_emblem_backend_gio_new());
+
+	}
+
+	return default_backend;
+
+}
+
+
+G_GNUC_WARN_UNUSED_RESULT GnuiEmblemBackend * gnui_emblem_backend_gio_new (
+	void
+) {
+
+	return g_object_new(GNUI_TYPE_EMBLEM_BACKEND_GIO, NULL);
+
+}
+
+
+G_GNUC_WARN_UNUSED_RESULT GnuiEmblemBackend * gnui_emblem_backend_memory_new (
+	void
+) {
+
+	return g_object_new(GNUI_TYPE_EMBLEM_BACKEND_MEMORY, NULL);
+
+}
+
+
+G_GNUC_WARN_UNUSED_RESULT gchar ** gnui_emblem_backend_memory_get_emblems (
+	GnuiEmblemBackendMemory * const self,
+	GFile * const location
+) {
+
+	g_return_val_if_fail(GNUI_IS_EMBLEM_BACKEND_MEMORY(self), NULL);
+	g_return_val_if_fail(G_IS_FILE(location), NULL);
+
+	gchar ** emblems;
+
+	g_mutex_lock(&self->lock);
+	emblems = g_strdupv(g_hash_table_lookup(self->store, location));
+	g_mutex_unlock(&self->lock);
+	return emblems;
+
+}
+
+
+void gnui_emblem_backend_memory_set_emblems (
+	GnuiEmblemBackendMemory * const self,
+	GFile * const location,
+	const gchar * const * const emblems
+) {
+
+	g_return_if_fail(GNUI_IS_EMBLEM_BACKEND_MEMORY(self));
+	g_return_if_fail(G_IS_FILE(location));
+
+	g_mutex_lock(&self->lock);
+
+	if (emblems && *emblems) {
+
+		g_hash_table_replace(
+			self->store,
+			g_object_ref(location),
+			g_strdupv((gchar **) emblems)
+		);
+
+	} else {
+
+		g_hash_table_remove(self->store, location);
+
+	}
+
+	g_mutex_unlock(&self->lock);
+
+}
+
+
+guint gnui_emblem_backend_memory_get_n_writes (
+	GnuiEmblemBackendMemory * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_EMBLEM_BACKEND_MEMORY(self), 0);
+
+	guint n_writes;
+
+	g_mutex_lock(&self->lock);
+	n_writes = self->n_writes;
+	g_mutex_unlock(&self->lock);
+	return n_writes;
+
+}
+
+
+/*  EOF  */
+
@@ -0,0 +1,331 @@
+/*  -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 4; tab-width: 4 -*-  */
+
+/*\
+|*|
+|*| gnui-emblem-backend.h
+|*|
+|*| https://github.com/madmurphy/libgnuisance
+|*|
+|*| Copyright (C) 2022 <madmurphy333@gmail.com>
+|*|
+|*| **libgnuisance** is free software: you can redistribute it and/or modify it
+|*| under the terms of the GNU General Public License as published by the Free
+|*| Software Foundation, either version 3 of the License, or (at your option)
+|*| any later version.
+|*|
+|*| **libgnuisance** is distributed in the hope that it will be useful, but
+|*| WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+|*| or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+|*| more details.
+|*|
+|*| You should have received a copy of the GNU General Public License along
+|*| with this program. If not, see <http://www.gnu.org/licenses/>.
+|*|
+\*/
+
+
+
+#ifndef _GNUI_EMBLEM_BACKEND_H_
+#define _GNUI_EMBLEM_BACKEND_H_
+
+
+#include <gio/gio.h>
+
+
+G_BEGIN_DECLS
+
+
+/**
+
+    SECTION:gnui-emblem-backend
+    @title: GnuiEmblemBackend
+    @short_description: Where the emblems of the files are stored
+    @section_id: gnui-emblem-backend
+    @see_also: #GnuiEmblemPicker
+    @stability: Unstable
+    @include: gnuisance/gnui-emblem-backend.h
+
+    `GnuiEmblemBackend` is the interface that `GnuiEmblemPicker` uses to read
+    and write the emblems of its files. The files are always handed to a
+    backend in batches, so that a backend that is able to do so can commit
+    thousands of changes in a single operation (e.g. a single database
+    transaction).
+
+    Two backends are provided: `GnuiEmblemBackendGio`, which stores the
+    emblems in the `metadata::emblems` attribute of GIO (the default), and
+    `GnuiEmblemBackendMemory`, which keeps them in memory and is meant for
+    tests and benchmarks.
+
+    The batch functions of a backend are invoked from worker threads, and
+    possibly from more than one thread at the same time.
+
+**/
+
+
+/**
+
+    GNUI_TYPE_EMBLEM_BACKEND:
+
+    The `GType` of `GnuiEmblemBackend`
+
+**/
+#define GNUI_TYPE_EMBLEM_BACKEND (gnui_emblem_backend_get_type())
+
+
+/**
+
+    GNUI_TYPE_EMBLEM_BACKEND_GIO:
+
+    The `GType` of `GnuiEmblemBackendGio`
+
+**/
+#define GNUI_TYPE_EMBLEM_BACKEND_GIO (gnui_emblem_backend_gio_get_type())
+
+
+/**
+
+    GNUI_TYPE_EMBLEM_BACKEND_MEMORY:
+
+    The `GType` of `GnuiEmblemBackendMemory`
+
+**/
+#define GNUI_TYPE_EMBLEM_BACKEND_MEMORY (gnui_emblem_backend_memory_get_type())
+
+
+/**
+
+    GnuiEmblemBackend:
+
+    The `GnuiEmblemBackend` interface
+
+**/
+G_DECLARE_INTERFACE(
+    GnuiEmblemBackend,
+    gnui_emblem_backend,
+    GNUI,
+    EMBLEM_BACKEND,
+    GObject
+)
+
+
+/**
+
+    GnuiEmblemBackendInterface:
+    @parent_iface:  The parent interface
+    @read_batch:    Read the emblems of a batch of files (see
+                    `gnui_emblem_backend_read_batch()`)
+    @write_batch:   Write the emblems of a batch of files (see
+                    `gnui_emblem_backend_write_batch()`)
+
+    The emblem backend's interface
+
+**/
+struct _GnuiEmblemBackendInterface {
+    GTypeInterface parent_iface;
+    void (* read_batch) (
+        GnuiEmblemBackend * self,
+        GFile * const * locations,
+        gsize n_files,
+        gchar *** emblems,
+        GError ** errors,
+        GCancellable * cancellable
+    );
+    void (* write_batch) (
+        GnuiEmblemBackend * self,
+        GFile * const * locations,
+        const gchar * const * const * emblems,
+        gsize n_files,
+        GError ** errors,
+        GCancellable * cancellable
+    );
+};
+
+
+/**
+
+    GnuiEmblemBackendGio:
+
+    The `GnuiEmblemBackendGio` emblem backend
+
+**/
+G_DECLARE_FINAL_TYPE(
+    GnuiEmblemBackendGio,
+    gnui_emblem_backend_gio,
+    GNUI,
+    EMBLEM_BACKEND_GIO,
+    GObject
+)
+
+
+/**
+
+    GnuiEmblemBackendMemory:
+
+    The `GnuiEmblemBackendMemory` emblem backend
+
+**/
+G_DECLARE_FINAL_TYPE(
+    GnuiEmblemBackendMemory,
+    gnui_emblem_backend_memory,
+    GNUI,
+    EMBLEM_BACKEND_MEMORY,
+    GObject
+)
+
+
+/**
+
+    gnui_emblem_backend_read_batch:
+    @self:          (not nullable): The emblem backend
+    @locations:     (array length=n_files) (not nullable): The files to read
+    @n_files:       The number of files in @locations
+    @emblems:       (array length=n_files) (out caller-allocates): An array
+                    that for each file receives a `NULL`-terminated array of
+                    emblems (transfer full), or `NULL` if the file has no
+                    emblems or could not be read
+    @errors:        (array length=n_files) (out caller-allocates): An array
+                    that for each file receives the error that occurred
+                    (transfer full), or `NULL`
+    @cancellable:   (nullable): A `GCancellable`
+
+    Read the emblems of a batch of files
+
+    Both @emblems and @errors must be zero-filled by the caller.
+
+**/
+extern void gnui_emblem_backend_read_batch (
+    GnuiEmblemBackend * const self,
+    GFile * const * const locations,
+    const gsize n_files,
+    gchar *** const emblems,
+    GError ** const errors,
+    GCancellable * const cancellable
+);
+
+
+/**
+
+    gnui_emblem_backend_write_batch:
+    @self:          (not nullable): The emblem backend
+    @locations:     (array length=n_files) (not nullable): The files to write
+    @emblems:       (array length=n_files) (not nullable): For each file, the
+                    `NULL`-terminated array of emblems to store, or `NULL` to
+                    remove all emblems
+    @n_files:       The number of files in @locations
+    @errors:        (array length=n_files) (out caller-allocates): An array
+                    that for each file receives the error that occurred
+                    (transfer full), or `NULL`
+    @cancellable:   (nullable): A `GCancellable`
+
+    Write the emblems of a batch of files
+
+    The @errors array must be zero-filled by the caller.
+
+**/
+extern void gnui_emblem_backend_write_batch (
+    GnuiEmblemBackend * const self,
+    GFile * const * const locations,
+    const gchar * const * const * const emblems,
+    const gsize n_files,
+    GError ** const errors,
+    GCancellable * const cancellable
+);
+
+
+/**
+
+    gnui_emblem_backend_get_default:
+
+    Get the default emblem backend (a `GnuiEmblemBackendGio`)
+
+    Returns:    (transfer none): The default emblem backend
+
+**/
+extern GnuiEmblemBackend * gnui_emblem_backend_get_default (void);
+
+
+/**
+
+    gnui_emblem_backend_gio_new:
+
+    Create a new emblem backend that stores the emblems in the
+    `metadata::emblems` attribute of GIO
+
+    Returns:    (transfer full): The newly created emblem backend
+
+**/
+extern GnuiEmblemBackend * gnui_emblem_backend_gio_new (void)
+    G_GNUC_WARN_UNUSED_RESULT;
+
+
+/**
+
+    gnui_emblem_backend_memory_new:
+
+    Create a new emblem backend that keeps the emblems in memory
+
+    Returns:    (transfer full): The newly created emblem backend
+
+**/
+extern GnuiEmblemBackend * gnui_emblem_backend_memory_new (void)
+    G_GNUC_WARN_UNUSED_RESULT;
+
+
+/**
+
+    gnui_emblem_backend_memory_get_emblems:
+    @self:      (not nullable): The in-memory emblem backend
+    @location:  (not nullable): The file
+
+    Get the emblems that an in-memory emblem backend stores for a file
+
+    Returns:    (transfer full) (nullable): A `NULL`-terminated array of
+                emblems, or `NULL` if the file has no emblems
+
+**/
+extern gchar ** gnui_emblem_backend_memory_get_emblems (
+    GnuiEmblemBackendMemory * const self,
+    GFile * const location
+) G_GNUC_WARN_UNUSED_RESULT;
+
+
+/**
+
+    gnui_emblem_backend_memory_set_emblems:
+    @self:      (not nullable): The in-memory emblem backend
+    @location:  (not nullable): The file
+    @emblems:   (transfer none) (nullable): A `NULL`-terminated array of
+                emblems, or `NULL` to remove all emblems
+
+    Set the emblems that an in-memory emblem backend stores for a file
+
+**/
+extern void gnui_emblem_backend_memory_set_emblems (
+    GnuiEmblemBackendMemory * const self,
+    GFile * const location,
+    const gchar * const * const emblems
+);
+
+
+/**
+
+    gnui_emblem_backend_memory_get_n_writes:
+    @self:      (not nullable): The in-memory emblem backend
+
+    Get how many batches have been written into an in-memory emblem backend
+
+    Returns:    The number of write batches received so far
+
+**/
+extern guint gnui_emblem_backend_memory_get_n_writes (
+    GnuiEmblemBackendMemory * const self
+);
+
+
+G_END_DECLS
+
+
+#endif
+
+
+/*  EOF  */
@@ -35,6 +35,7 @@
 #include <adwaita.h>
 #include "gnui-definitions.h"
 #include "gnui-internals.h"
+#include "gnui-flow.h"
 #include "gnui-emblem-picker.h"
 
 
@@ -46,18 +47,6 @@
 \*/
 
 
-#ifndef G_FILE_ATTRIBUTE_METADATA_EMBLEMS
-/**
-
-    G_FILE_ATTRIBUTE_METADATA_EMBLEMS:
-
-    The attribute string for emblems
-
-**/
-#define G_FILE_ATTRIBUTE_METADATA_EMBLEMS "metadata::emblems"
-#endif
-
-
 /**
 
     GNUI_EMBLEM_PICKER_ICON_SIZE:
@@ -88,6 +77,27 @@
 #define GNUI_EMBLEM_PICKER_PAGE_MIN_HEIGHT 250
 
 
+/**
+
+    GNUI_EMBLEM_PICKER_BATCH_SIZE:
+
+    The maximum number of files handed to the emblem backend at once
+
+**/
+#define GNUI_EMBLEM_PICKER_BATCH_SIZE 32
+
+
+/**
+
+    GNUI_EMBLEM_PICKER_MAX_PENDING_BATCHES:
+
+    The maximum number of batches of files whose emblems are being read or
+    written at the same time
+
+**/
+#define GNUI_EMBLEM_PICKER_MAX_PENDING_BATCHES 8
+
+
 /**
 
     GNUI_INDICATOR_GLYPH_DOWN_TO_SOME:
@@ -148,6 +158,17 @@
 #define GNUI_INDICATOR_GLYPH_BLANK ""
 
 
+/**
+
+    GNUI_BITSET_N_WORDS:
+    @N_BITS:    The number of bits
+
+    The number of `guint64` words needed by a bitset of @N_BITS bits
+
+**/
+#define GNUI_BITSET_N_WORDS(N_BITS) (((N_BITS) + 63) / 64)
+
+
 /**
 
     GNUI_TYPE_EMBLEM_PICKER_EMBLEM:
@@ -162,7 +183,7 @@
 
     GnuiEmblemPickerEmblem:
 
-    A widget derived from `GtkFlowBoxChild` used only internally
+    A widget derived from `GtkButton` used only internally
 
 **/
 G_DECLARE_FINAL_TYPE(
@@ -170,7 +191,35 @@ G_DECLARE_FINAL_TYPE(
     gnui_emblem_picker_emblem,
     GNUI,
     EMBLEM_PICKER_EMBLEM,
-    GtkFlowBoxChild
+    GtkButton
+)
+
+
+/**
+
+    GNUI_TYPE_EMBLEM_PICKER_REFERENCE:
+
+    A `GType` for `GnuiEmblemPickerReference`
+
+**/
+#define GNUI_TYPE_EMBLEM_PICKER_REFERENCE \
+	(gnui_emblem_picker_reference_get_type())
+
+
+/**
+
+    GnuiEmblemPickerReference:
+
+    An object derived from `GObject` used only internally (it is the item type
+    of the models displayed by the emblem views)
+
+**/
+G_DECLARE_FINAL_TYPE(
+    GnuiEmblemPickerReference,
+    gnui_emblem_picker_reference,
+    GNUI,
+    EMBLEM_PICKER_REFERENCE,
+    GObject
 )
 
 
@@ -225,20 +274,30 @@ typedef enum _GnuiEmblemPickerPageNum {
 
 /**
 
-    EmblemReference:
+    GnuiEmblemPickerReference:
 
     Information about a single emblem in the emblem picker
 
+    The `controller_cell` member is the cell that currently displays the
+    emblem, or `NULL` if the emblem is scrolled out of view.
+
+    The `inconsistent_files` member is a bitset over the indices of
+    #GnuiEmblemPicker:mapped-files that marks the files that had the emblem
+    assigned when the state was inconsistent (or `NULL`); the
+    `inconsistent_group` member is the same set as a `GList` of `GFile`
+    objects, built only when the public API asks for it.
+
 **/
-typedef struct _EmblemReference {
+struct _GnuiEmblemPickerReference {
+	GObject parent_instance;
 	gchar * name;
-	GtkWidget * controller_cell;
-	GtkLabel * change_indicator;
+	GnuiEmblemPickerEmblem * controller_cell;
+	guint64 * inconsistent_files;
 	GList * inconsistent_group;
 	GnuiEmblemState saved_state;
 	GnuiEmblemState current_state;
 	bool unsupported;
-} EmblemReference;
+};
 
 
 /**
@@ -250,6 +309,7 @@ typedef struct _EmblemReference {
 **/
 struct _GnuiEmblemPicker {
 	GtkWidget parent_instance;
+	GnuiEmblemBackend * backend;
 	GList * mapped_files;
 	gchar ** forbidden_emblems;
 	bool
@@ -268,6 +328,8 @@ struct _GnuiEmblemPicker {
 **/
 typedef struct _GnuiEmblemPickerPage {
 	AdwLeaflet * pager;
+	GListStore * emblem_store;
+	GtkFilter * emblem_filter;
 	GtkWidget
 		* emblem_view,
 		* search_box,
@@ -276,12 +338,134 @@ typedef struct _GnuiEmblemPickerPage {
 } GnuiEmblemPickerPage;
 
 
+/**
+
+    GnuiEmblemPickerLoader:
+
+    The state of an asynchronous emblem loading session
+
+    The `picker` member is set to `NULL` when the picker abandons the loader
+    (e.g. when it is disposed or when the mapped files change); an abandoned
+    loader frees itself as soon as its last pending batch returns. The
+    `files` member lists the mapped files in order; `read_files` is the bitset
+    of the files whose emblems have been read successfully.
+
+**/
+typedef struct _GnuiEmblemPickerLoader {
+	GnuiEmblemPicker * picker;
+	GnuiEmblemBackend * backend;
+	GCancellable * cancellable;
+	GHashTable * assignments;
+	GFile ** files;
+	guint64 * read_files;
+	gsize n_files;
+	gsize n_words;
+	gsize next_file;
+	gsize n_pending;
+} GnuiEmblemPickerLoader;
+
+
+typedef struct _GnuiEmblemPickerSaver GnuiEmblemPickerSaver;
+
+
+/**
+
+    GnuiEmblemPickerSaveJob:
+
+    What must be written into a mapped file
+
+    The `emblems` member is the new value of the file's emblem metadata
+    (`NULL` for no emblems); `additions` and `removals` are the emblems added
+    to and removed from the file (`NULL` when empty). The names are borrowed
+    from the emblem references. The `saver` member is `NULL` when the job
+    belongs to a synchronous save. The `is_unknown` member is set when the
+    file's emblems were never read, in which case the file is never written.
+
+**/
+typedef struct _GnuiEmblemPickerSaveJob {
+	GnuiEmblemPickerSaver * saver;
+	GFile * location;
+	const gchar ** emblems;
+	const gchar ** additions;
+	const gchar ** removals;
+	bool is_unknown;
+} GnuiEmblemPickerSaveJob;
+
+
+/**
+
+    GnuiEmblemPickerSaver:
+
+    The state of an asynchronous save session
+
+    The `picker` member is set to `NULL` when the picker abandons the session
+    (when the mapped files change); the writes are then carried out anyway,
+    but the picker's saved states are left untouched. The `references` member
+    holds a reference to each emblem reference whose name is borrowed by the
+    jobs.
+
+**/
+struct _GnuiEmblemPickerSaver {
+	GnuiEmblemPicker * picker;
+	GnuiEmblemBackend * backend;
+	GTask * task;
+	GCancellable * cancellable;
+	GCancellable * user_cancellable;
+	GList * references;
+	GnuiEmblemPickerSaveJob * jobs;
+	GnuiEmblemPickerForeachSavedFileFunc for_each_file;
+	gpointer for_each_data;
+	GError * error;
+	gsize n_jobs;
+	gsize next_job;
+	gsize n_pending;
+	gsize n_saved;
+	gsize n_failed;
+	gsize n_unchanged;
+	gulong cancel_handler;
+	GnuiEmblemPickerSaveFlags flags;
+	bool aborted;
+};
+
+
+/**
+
+    GnuiEmblemPickerBatch:
+
+    A batch of files handed to the emblem backend from a worker thread
+
+    The `session` member is the `GnuiEmblemPickerLoader` or the
+    `GnuiEmblemPickerSaver` that the batch belongs to. When reading, the
+    `locations` member points into the loader's `files` array starting at
+    index `first`, and `emblems` receives the emblems of each file; when
+    writing, `locations`, `emblems` (borrowed) and `jobs` are gathered from
+    the save jobs that need a write.
+
+**/
+typedef struct _GnuiEmblemPickerBatch {
+	gpointer session;
+	GnuiEmblemBackend * backend;
+	GFile ** locations;
+	gchar *** emblems;
+	GError ** errors;
+	GnuiEmblemPickerSaveJob ** jobs;
+	gsize first;
+	gsize n_files;
+} GnuiEmblemPickerBatch;
+
+
 /**
 
     GnuiEmblemPickerPrivate:
 
     The emblem picker's private `struct`
 
+    The `reference_index` member maps the names of the emblems to their
+    references in `references` (borrowed); the `n_modified` member counts the
+    emblem references whose current state differs from their saved state. The
+    `read_files` member is the bitset of the mapped files whose emblems have
+    been read, or `NULL` if the last loading session read all of them.
+
 **/
 typedef struct _GnuiEmblemPickerPrivate {
 	GnuiEmblemPickerPage pages[N_EMBLEM_PICKER_PAGES];
@@ -293,7 +477,12 @@ typedef struct _GnuiEmblemPickerPrivate {
 		* page_1_of_2,
 		* supported_container;
 	GList * references;
+	GHashTable * reference_index;
+	GnuiEmblemPickerLoader * loader;
+	GnuiEmblemPickerSaver * saver;
+	guint64 * read_files;
 	gulong icon_theme_refresh_signal;
+	guint n_modified;
 	bool is_single_page;
 } GnuiEmblemPickerPrivate;
 
@@ -306,8 +495,10 @@ typedef struct _GnuiEmblemPickerPrivate {
 
 **/
 struct _GnuiEmblemPickerEmblem {
-	GtkFlowBoxChild parent_instance;
-	EmblemReference * emref;
+	GtkButton parent_instance;
+	GnuiEmblemPickerReference * emref;
+	GtkWidget * face;
+	GtkLabel * change_indicator;
 };
 
 
@@ -321,7 +512,14 @@ G_DEFINE_FINAL_TYPE_WITH_PRIVATE(
 G_DEFINE_FINAL_TYPE(
 	GnuiEmblemPickerEmblem,
 	gnui_emblem_picker_emblem,
-	GTK_TYPE_FLOW_BOX_CHILD
+	GTK_TYPE_BUTTON
+)
+
+
+G_DEFINE_FINAL_TYPE(
+	GnuiEmblemPickerReference,
+	gnui_emblem_picker_reference,
+	G_TYPE_OBJECT
 )
 
 
@@ -332,10 +530,12 @@ enum {
 
 	/*  Properties  */
 	PROPERTY_MAPPED_FILES,
+	PROPERTY_BACKEND,
 	PROPERTY_FORBIDDEN_EMBLEMS,
 	PROPERTY_ENSURE_STANDARD,
 	PROPERTY_MODIFIED,
 	PROPERTY_REVEAL_CHANGES,
+	PROPERTY_LOADING,
 
 	/*  Number of properties  */
 	N_PROPERTIES
@@ -483,71 +683,164 @@ G_GNUC_WARN_UNUSED_RESULT static GList * get_available_emblems (
 }
 
 
-/*  Callbacks  */
+/**
+
+    gnui_bitset_add:
+    @bitset:    (not nullable): The bitset
+    @bit:       The index of the bit to set
+
+    Add an index to a bitset
+
+**/
+static inline void gnui_bitset_add (
+	guint64 * const bitset,
+	const gsize bit
+) {
+
+	bitset[bit / 64] |= G_GUINT64_CONSTANT(1) << (bit % 64);
+
+}
 
 
 /**
 
-    gnui_emblem_picker_sort_emblem_references:
-    @ref_a:     (auto) (not nullable): The first emblem reference
-    @ref_b:     (auto) (not nullable): The second emblem reference
+    gnui_bitset_contains:
+    @bitset:    (nullable): The bitset
+    @bit:       The index of the bit to test
 
-    Sort two emblem references
+    Check whether a bitset contains an index (a `NULL` bitset is empty)
 
-    Returns:    Exactly like `strcmp()`
+    Returns:    `true` if the bit is set, `false` otherwise
 
 **/
-static int gnui_emblem_picker_sort_emblem_references (
-	const EmblemReference * const ref_a,
-	const EmblemReference * const ref_b
+static inline bool gnui_bitset_contains (
+	const guint64 * const bitset,
+	const gsize bit
 ) {
 
-	return strcmp(ref_a->name, ref_b->name);
+	return bitset && (bitset[bit / 64] >> (bit % 64) & 1);
+
+}
+
+
+/**
+
+    gnui_bitset_count:
+    @bitset:    (not nullable): The bitset
+    @n_bits:    The size of the bitset in bits
+
+    Count the bits that are set in a bitset
+
+    Returns:    The number of bits that are set
+
+**/
+static inline gsize gnui_bitset_count (
+	const guint64 * const bitset,
+	const gsize n_bits
+) {
+
+	gsize count = 0;
+
+	for (gsize idx = 0; idx < GNUI_BITSET_N_WORDS(n_bits); idx++) {
+
+		count += __builtin_popcountll(bitset[idx]);
+
+	}
+
+	return count;
+
+}
+
+
+/**
+
+    gnui_emblem_picker_save_job_needs_write:
+    @job:       (not nullable): The save job
+    @flags:     The flags the save was requested with
+
+    Check whether a save job requires writing into the file
+
+    Returns:    `true` if the file must be written, `false` otherwise
+
+**/
+static inline bool gnui_emblem_picker_save_job_needs_write (
+	const GnuiEmblemPickerSaveJob * const job,
+	const GnuiEmblemPickerSaveFlags flags
+) {
+
+	return !job->is_unknown && (
+		job->additions ||
+		job->removals ||
+		(flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_SAVE_UNMODIFIED)
+	);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_reference_change_state:
+    @priv:      (not nullable): The emblem picker's private `struct`
+    @emref:     (not nullable): The emblem reference
+    @state:     The new current state of the emblem
+
+    Change the current state of an emblem reference, keeping count of the
+    references that differ from their saved state
+
+**/
+static inline void gnui_emblem_picker_reference_change_state (
+	GnuiEmblemPickerPrivate * const priv,
+	GnuiEmblemPickerReference * const emref,
+	const GnuiEmblemState state
+) {
+
+	priv->n_modified -= emref->current_state != emref->saved_state;
+	emref->current_state = state;
+	priv->n_modified += state != emref->saved_state;
 
 }
 
 
+/*  Callbacks  */
+
+
 /**
 
-    gnui_emblem_picker_sort_emblem_cells:
-    @cell_a:    (auto) (not nullable): The first emblem cell
-    @cell_b:    (auto) (not nullable): The second emblem cell
+    gnui_emblem_picker_sort_emblem_references:
+    @ref_a:     (auto) (not nullable): The first emblem reference
+    @ref_b:     (auto) (not nullable): The second emblem reference
     @data:      (auto) (unused): The closure data
 
-    Sort two emblem cells
+    Sort two emblem references
 
     Returns:    Exactly like `strcmp()`
 
 **/
-static int gnui_emblem_picker_sort_emblem_cells (
-	GtkFlowBoxChild * const cell_a,
-	GtkFlowBoxChild * const cell_b,
+static int gnui_emblem_picker_sort_emblem_references (
+	const GnuiEmblemPickerReference * const ref_a,
+	const GnuiEmblemPickerReference * const ref_b,
 	const gpointer data G_GNUC_UNUSED
 ) {
 
-	return strcmp(
-		GNUI_EMBLEM_PICKER_EMBLEM(cell_a)->emref->name,
-		GNUI_EMBLEM_PICKER_EMBLEM(cell_b)->emref->name
-	);
+	return strcmp(ref_a->name, ref_b->name);
 
 }
 
 
 /**
 
-    gnui_emblem_picker_filter_emblem_cell:
-    @emblem_cell:   (auto) (not nullable): The emblem cell (a
-                    `GnuiEmblemPickerEmblem` passed as `GtkFlowBoxChild`)
-    @v_page:        (auto) (not nullable): The current `GnuiEmblemPickerPage`
-                    passed as `gpointer`
+    gnui_emblem_picker_filter_emblem_reference:
+    @emref:     (auto) (not nullable): The emblem reference (the model's item)
+    @v_page:    (auto) (not nullable): The current `GnuiEmblemPickerPage`
+                passed as `gpointer`
 
-    Decide whether an emblem cell must be shown or not
+    Decide whether an emblem must be shown or not
 
-    Returns:    `true` if the cell must be shown, `false` otherwise 
+    Returns:    `true` if the emblem must be shown, `false` otherwise 
 
 **/
-static gboolean gnui_emblem_picker_filter_emblem_cell (
-	GtkFlowBoxChild * const emblem_cell,
+static gboolean gnui_emblem_picker_filter_emblem_reference (
+	GnuiEmblemPickerReference * const emref,
 	const gpointer v_page
 ) {
 
@@ -557,7 +850,7 @@ static gboolean gnui_emblem_picker_filter_emblem_cell (
 		!gtk_revealer_get_reveal_child(
 			GTK_REVEALER(page->search_box)
 		) || g_strrstr(
-			GNUI_EMBLEM_PICKER_EMBLEM(emblem_cell)->emref->name,
+			emref->name,
 			gtk_editable_get_text(GTK_EDITABLE(page->search_entry))
 		);
 
@@ -567,6 +860,80 @@ static gboolean gnui_emblem_picker_filter_emblem_cell (
 
 
 
+/**
+
+    gnui_emblem_picker_read_batch_in_thread:
+    @task:          (auto) (not nullable): The batch's `GTask`
+    @source:        (auto) (unused): The task's source object
+    @v_batch:       (auto) (not nullable): The `GnuiEmblemPickerBatch`
+                    passed as `gpointer`
+    @cancellable:   (auto) (nullable): The session's `GCancellable`
+
+    Read a batch of files from a worker thread (`GTaskThreadFunc`)
+
+**/
+static void gnui_emblem_picker_read_batch_in_thread (
+	GTask * const task,
+	const gpointer source G_GNUC_UNUSED,
+	const gpointer v_batch,
+	GCancellable * const cancellable
+) {
+
+	#define batch ((GnuiEmblemPickerBatch *) v_batch)
+
+	gnui_emblem_backend_read_batch(
+		batch->backend,
+		batch->locations,
+		batch->n_files,
+		batch->emblems,
+		batch->errors,
+		cancellable
+	);
+
+	#undef batch
+
+	g_task_return_boolean(task, true);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_write_batch_in_thread:
+    @task:          (auto) (not nullable): The batch's `GTask`
+    @source:        (auto) (unused): The task's source object
+    @v_batch:       (auto) (not nullable): The `GnuiEmblemPickerBatch`
+                    passed as `gpointer`
+    @cancellable:   (auto) (nullable): The session's `GCancellable`
+
+    Write a batch of files from a worker thread (`GTaskThreadFunc`)
+
+**/
+static void gnui_emblem_picker_write_batch_in_thread (
+	GTask * const task,
+	const gpointer source G_GNUC_UNUSED,
+	const gpointer v_batch,
+	GCancellable * const cancellable
+) {
+
+	#define batch ((GnuiEmblemPickerBatch *) v_batch)
+
+	gnui_emblem_backend_write_batch(
+		batch->backend,
+		batch->locations,
+		(const gchar * const * const *) batch->emblems,
+		batch->n_files,
+		batch->errors,
+		cancellable
+	);
+
+	#undef batch
+
+	g_task_return_boolean(task, true);
+
+}
+
+
 /*  Implementation  */
 
 
@@ -575,19 +942,25 @@ static gboolean gnui_emblem_picker_filter_emblem_cell (
     gnui_emblem_picker_refresh_cell:
     @emref:     (not nullable): The emblem reference
 
-    Refresh an emblem picker cell
+    Refresh the emblem picker cell that displays an emblem (if any)
 
 **/
 static void gnui_emblem_picker_refresh_cell (
-	const EmblemReference * const emref
+	const GnuiEmblemPickerReference * const emref
 ) {
 
 	const GnuiEmblemState state = emref->current_state;
 
-	gnui_set_emblem_cell_gtk_state(emref->controller_cell, state);
+	if (!emref->controller_cell) {
+
+		return;
+
+	}
+
+	gnui_set_emblem_cell_gtk_state(GTK_WIDGET(emref->controller_cell), state);
 
 	gtk_label_set_text(
-		emref->change_indicator,
+		emref->controller_cell->change_indicator,
 		emref->saved_state == GNUI_EMBLEM_STATE_SELECTED ?
 			(
 				state == GNUI_EMBLEM_STATE_SELECTED ?
@@ -619,272 +992,244 @@ static void gnui_emblem_picker_refresh_cell (
 
 /**
 
-    gnui_emblem_picker_toggle_emblem_reference:
-    @self:      (not nullable): The emblem picker
-    @emref:     (not nullable): The emblem reference
+    gnui_emblem_picker_reference_set_owners:
+    @emref:         (not nullable): The emblem reference
+    @owners:        (transfer full) (nullable): A bitset over the indices of
+                    the mapped files that marks the files that have the emblem
+                    assigned, or `NULL` if no file has it
+    @file_amount:   The number of mapped files
 
-    Toggle/untoggle an emblem picker cell
+    Set the saved and current state of an emblem reference once all the mapped
+    files have been read
 
 **/
-static void gnui_emblem_picker_toggle_emblem_reference (
-	GnuiEmblemPicker * const self,
-	EmblemReference * const emref
+static void gnui_emblem_picker_reference_set_owners (
+	GnuiEmblemPickerReference * const emref,
+	guint64 * const owners,
+	const gsize file_amount
 ) {
 
-	const GnuiEmblemPickerPrivate * const priv =
-		gnui_emblem_picker_get_instance_private(self);
+	if (!owners) {
 
-	gboolean is_modified;
+		emref->saved_state = emref->current_state = GNUI_EMBLEM_STATE_NORMAL;
 
-	emref->current_state =
-		emref->inconsistent_group &&
-		emref->current_state == GNUI_EMBLEM_STATE_SELECTED  ?
-			GNUI_EMBLEM_STATE_INCONSISTENT
-		: emref->current_state == GNUI_EMBLEM_STATE_NORMAL ?
-			GNUI_EMBLEM_STATE_SELECTED
-		:
-			GNUI_EMBLEM_STATE_NORMAL;
+	} else if (gnui_bitset_count(owners, file_amount) < file_amount) {
 
-	gnui_emblem_picker_refresh_cell(emref);
+		emref->saved_state = emref->current_state =
+			GNUI_EMBLEM_STATE_INCONSISTENT;
+
+		emref->inconsistent_files = owners;
+
+	} else {
 
-	if (emref->current_state == emref->saved_state) {
+		emref->saved_state = emref->current_state = GNUI_EMBLEM_STATE_SELECTED;
+		g_free(owners);
 
-		const GList * refllnk = priv->references;
+	}
 
-		find_emblem_reference: if (refllnk) {
+}
 
-			#define iter_emref ((EmblemReference *) refllnk->data)
 
-			if (iter_emref->current_state == iter_emref->saved_state) {
+/**
 
-				refllnk = refllnk->next;
-				goto find_emblem_reference;
+    gnui_emblem_picker_peek_inconsistent_group:
+    @self:      (not nullable): The emblem picker
+    @emref:     (not nullable): The emblem reference
 
-			}
+    Get the inconsistent group of an emblem reference as a `GList` of `GFile`
+    objects, building it from the reference's bitset the first time
 
-			is_modified = true;
+    Returns:    (transfer none) (nullable): The inconsistent group of files
 
-			#undef iter_emref
+**/
+static const GList * gnui_emblem_picker_peek_inconsistent_group (
+	const GnuiEmblemPicker * const self,
+	GnuiEmblemPickerReference * const emref
+) {
 
-		} else {
+	if (emref->inconsistent_files && !emref->inconsistent_group) {
 
-			is_modified = false;
+		gsize file_idx = 0;
 
-		}
+		for (
+			const GList * llnk = self->mapped_files;
+				llnk;
+			llnk = llnk->next, file_idx++
+		) {
 
-	} else {
+			if (gnui_bitset_contains(emref->inconsistent_files, file_idx)) {
 
-		is_modified = true;
+				emref->inconsistent_group =
+					g_list_prepend(emref->inconsistent_group, llnk->data);
 
-	}
+			}
 
-	if (self->modified != is_modified) {
+		}
 
-		self->modified = is_modified;
-		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_MODIFIED]);
-		g_signal_emit(self, signals[SIGNAL_MODIFIED_CHANGED], 0, is_modified);
+		emref->inconsistent_group = g_list_reverse(emref->inconsistent_group);
 
 	}
 
-	g_signal_emit(
-		self,
-		signals[SIGNAL_EMBLEM_SELECTED],
-		0,
-		emref->name,
-		emref->saved_state,
-		emref->current_state,
-		emref->inconsistent_group
-	);
+	return emref->inconsistent_group;
 
 }
 
 
 /**
 
-    gnui_emblem_picker_reference_destroy:
+    gnui_emblem_picker_update_modified:
+    @self:      (not nullable): The emblem picker
     @priv:      (not nullable): The emblem picker's private `struct`
-    @emref:     (not nullable): The emblem reference to destroy
 
-    Destroy an emblem picker cell
+    Update the #GnuiEmblemPicker:modified property after some emblem states
+    have changed
 
 **/
-static void gnui_emblem_picker_reference_destroy (
-	const GnuiEmblemPickerPrivate * const priv,
-	EmblemReference * const emref
+static void gnui_emblem_picker_update_modified (
+	GnuiEmblemPicker * const self,
+	const GnuiEmblemPickerPrivate * const priv
 ) {
 
-	gtk_flow_box_remove(
-		GTK_FLOW_BOX(priv->pages[emref->unsupported].emblem_view),
-		emref->controller_cell
-	);
+	const gboolean is_modified = priv->n_modified > 0;
 
-	g_free(emref->name);
-	g_list_free(emref->inconsistent_group);
-	g_free(emref);
+	if (self->modified != is_modified) {
+
+		self->modified = is_modified;
+		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_MODIFIED]);
+		g_signal_emit(self, signals[SIGNAL_MODIFIED_CHANGED], 0, is_modified);
+
+	}
 
 }
 
 
 /**
 
-    gnui_emblem_picker_draw_supported_emblem:
+    gnui_emblem_picker_toggle_emblem_reference:
     @self:      (not nullable): The emblem picker
-    @priv:      (not nullable): The emblem picker's private `struct`
     @emref:     (not nullable): The emblem reference
 
-    Visualize an emblem in the supported emblem list
+    Toggle/untoggle an emblem picker cell
 
 **/
-static void gnui_emblem_picker_draw_supported_emblem (
+static void gnui_emblem_picker_toggle_emblem_reference (
 	GnuiEmblemPicker * const self,
-	const GnuiEmblemPickerPrivate * const priv,
-	EmblemReference * const emref
+	GnuiEmblemPickerReference * const emref
 ) {
 
-	GtkWidget * _widget_placeholder_1_, * _widget_placeholder_2_;
+	GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(self);
 
-	#define emblem_container _widget_placeholder_1_
-	#define emblem_image _widget_placeholder_2_
+	gnui_emblem_picker_reference_change_state(
+		priv,
+		emref,
+		emref->inconsistent_files &&
+		emref->current_state == GNUI_EMBLEM_STATE_SELECTED  ?
+			GNUI_EMBLEM_STATE_INCONSISTENT
+		: emref->current_state == GNUI_EMBLEM_STATE_NORMAL ?
+			GNUI_EMBLEM_STATE_SELECTED
+		:
+			GNUI_EMBLEM_STATE_NORMAL
+	);
 
-	emblem_container = gtk_overlay_new();
+	gnui_emblem_picker_refresh_cell(emref);
+	gnui_emblem_picker_update_modified(self, priv);
 
-	emblem_image = g_object_new(
-		GTK_TYPE_IMAGE,
-		"icon-name", emref->name,
-		"pixel-size", GNUI_EMBLEM_PICKER_ICON_SIZE,
-		"tooltip-text", emref->name,
-		NULL
+	g_signal_emit(
+		self,
+		signals[SIGNAL_EMBLEM_SELECTED],
+		0,
+		emref->name,
+		emref->saved_state,
+		emref->current_state,
+		gnui_emblem_picker_peek_inconsistent_group(self, emref)
 	);
 
-	gtk_widget_add_css_class(emblem_image, "emblem-image");
-	gtk_overlay_set_child(GTK_OVERLAY(emblem_container), emblem_image);
+}
 
-	#undef emblem_image
-	#define indicator _widget_placeholder_2_
 
-	indicator = g_object_new(
-		GTK_TYPE_LABEL,
-		"halign", GTK_ALIGN_START,
-		"valign", GTK_ALIGN_START,
-		NULL
-	);
+/**
 
-	g_object_bind_property(
-		self,
-		"reveal-changes",
-		indicator,
-		"visible",
-		G_BINDING_DEFAULT | G_BINDING_SYNC_CREATE
-	);
+    gnui_emblem_picker_restock_views:
+    @priv:      (not nullable): The emblem picker's private `struct`
 
-	gtk_widget_add_css_class(indicator, "change-indicator");
-	emref->change_indicator = GTK_LABEL(indicator);
-	gtk_overlay_add_overlay(GTK_OVERLAY(emblem_container), indicator);
+    Sort the emblem references and replace the content of the emblem views'
+    models with them
 
-	#undef indicator
-	#define emblem_cell _widget_placeholder_2_
+    Each model emits a single #GListModel::items-changed signal, and only the
+    cells that are visible get rebound.
 
-	emblem_cell = g_object_new(
-		GNUI_TYPE_EMBLEM_PICKER_EMBLEM,
-		"child", emblem_container,
-		NULL
-	);
+**/
+static void gnui_emblem_picker_restock_views (
+	GnuiEmblemPickerPrivate * const priv
+) {
 
-	gnui_set_emblem_cell_gtk_state(emblem_cell, emref->current_state);
-	gtk_widget_add_css_class(emblem_cell, "supported");
-	GNUI_EMBLEM_PICKER_EMBLEM(emblem_cell)->emref = emref;
-	emref->controller_cell = emblem_cell;
+	GPtrArray * stocks[N_EMBLEM_PICKER_PAGES];
+	GnuiEmblemPickerPageNum page_num;
 
-	gtk_flow_box_insert(
-		GTK_FLOW_BOX(priv->pages[PAGE_SUPPORTED].emblem_view),
-		emblem_cell,
-		-1
+	priv->references = g_list_sort_with_data(
+		priv->references,
+		(GCompareDataFunc) gnui_emblem_picker_sort_emblem_references,
+		NULL
 	);
 
-	#undef emblem_cell
-	#undef emblem_container
-
-}
+	for (page_num = 0; page_num < N_EMBLEM_PICKER_PAGES; page_num++) {
 
+		stocks[page_num] = g_ptr_array_new();
 
-/**
+	}
 
-    gnui_emblem_picker_draw_unsupported_emblem:
-    @self:      (not nullable): The emblem picker
-    @priv:      (not nullable): The emblem picker's private `struct`
-    @emref:     (not nullable): The emblem reference
+	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
 
-    Visualize an emblem in the unsupported emblem list
+		g_ptr_array_add(
+			stocks[((GnuiEmblemPickerReference *) llnk->data)->unsupported],
+			llnk->data
+		);
 
-**/
-static void gnui_emblem_picker_draw_unsupported_emblem (
-	GnuiEmblemPicker * const self,
-	const GnuiEmblemPickerPrivate * const priv,
-	EmblemReference * const emref
-) {
+	}
 
-	GtkWidget * _widget_placeholder_1_, * _widget_placeholder_2_;
+	for (page_num = 0; page_num < N_EMBLEM_PICKER_PAGES; page_num++) {
 
-	#define emblem_container _widget_placeholder_1_
-	#define emblem_label _widget_placeholder_2_
+		g_list_store_splice(
+			priv->pages[page_num].emblem_store,
+			0,
+			g_list_model_get_n_items(
+				G_LIST_MODEL(priv->pages[page_num].emblem_store)
+			),
+			stocks[page_num]->pdata,
+			stocks[page_num]->len
+		);
 
-	emblem_container = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 0);
+		g_ptr_array_free(stocks[page_num], true);
 
-	emblem_label = g_object_new(
-		GTK_TYPE_LABEL,
-		"label", emref->name,
-		"halign", GTK_ALIGN_START,
-		"hexpand", true,
-		NULL
-	);
+	}
 
-	gtk_widget_add_css_class(emblem_label, "emblem-name");
-	gtk_box_prepend(GTK_BOX(emblem_container), emblem_label);
+}
 
-	#undef emblem_label
-	#define indicator _widget_placeholder_2_
 
-	indicator = g_object_new(
-		GTK_TYPE_LABEL,
-		"halign", GTK_ALIGN_CENTER,
-		"valign", GTK_ALIGN_CENTER,
-		NULL
-	);
+/**
 
-	g_object_bind_property(
-		self,
-		"reveal-changes",
-		indicator,
-		"visible",
-		G_BINDING_DEFAULT | G_BINDING_SYNC_CREATE
-	);
+    gnui_emblem_picker_index_references:
+    @priv:      (not nullable): The emblem picker's private `struct`
 
-	gtk_widget_add_css_class(indicator, "change-indicator");
-	emref->change_indicator = GTK_LABEL(indicator);
-	gtk_box_append(GTK_BOX(emblem_container), indicator);
+    Rebuild the name => reference index of the emblem picker
 
-	#undef indicator
-	#define emblem_cell _widget_placeholder_2_
+**/
+static void gnui_emblem_picker_index_references (
+	GnuiEmblemPickerPrivate * const priv
+) {
 
-	emblem_cell = g_object_new(
-		GNUI_TYPE_EMBLEM_PICKER_EMBLEM,
-		"child", emblem_container,
-		NULL
-	);
+	g_hash_table_remove_all(priv->reference_index);
 
-	gnui_set_emblem_cell_gtk_state(emblem_cell, emref->current_state);
-	gtk_widget_add_css_class(emblem_cell, "unsupported");
-	GNUI_EMBLEM_PICKER_EMBLEM(emblem_cell)->emref = emref;
-	emref->controller_cell = emblem_cell;
+	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
 
-	gtk_flow_box_insert(
-		GTK_FLOW_BOX(priv->pages[PAGE_UNSUPPORTED].emblem_view),
-		emblem_cell,
-		-1
-	);
+		g_hash_table_insert(
+			priv->reference_index,
+			((GnuiEmblemPickerReference *) llnk->data)->name,
+			llnk->data
+		);
 
-	#undef emblem_cell
-	#undef emblem_container
+	}
 
 }
 
@@ -906,50 +1251,32 @@ static bool gnui_emblem_picker_add_standard_emblems (
 	GnuiEmblemPickerPrivate * const priv
 ) {
 
-	const GList * refllnk;
-	EmblemReference * emref;
+	GnuiEmblemPickerReference * emref;
 	bool has_one_page = true;
 	gsize idx = 0;
 
 	do {
 
 		if (
-			self->forbidden_emblems && g_strv_contains(
-				(const gchar * const *) self->forbidden_emblems,
-				xdg_emblems[idx]
-			)
+			(
+				self->forbidden_emblems && g_strv_contains(
+					(const gchar * const *) self->forbidden_emblems,
+					xdg_emblems[idx]
+				)
+			) || g_hash_table_contains(priv->reference_index, xdg_emblems[idx])
 		) {
 
 			continue;
 
 		}
 
-		refllnk = priv->references;
-
-		search_standard_in_stock: if (refllnk) {
-
-			if (
-				strcmp(
-					((EmblemReference *) refllnk->data)->name,
-					xdg_emblems[idx])
-			) {
-
-				refllnk = refllnk->next;
-				goto search_standard_in_stock;
-
-			}
-
-			continue;
-
-		}
-
-		emref = g_new(EmblemReference, 1);
+		emref = g_object_new(GNUI_TYPE_EMBLEM_PICKER_REFERENCE, NULL);
 		emref->name = g_strdup(xdg_emblems[idx]);
 		emref->unsupported = true;
 		emref->inconsistent_group = NULL;
 		emref->saved_state = emref->current_state = GNUI_EMBLEM_STATE_NORMAL;
-		gnui_emblem_picker_draw_unsupported_emblem(self, priv, emref);
 		priv->references = g_list_prepend(priv->references, emref);
+		g_hash_table_insert(priv->reference_index, emref->name, emref);
 		has_one_page = false;
 
 	} while (++idx < N_XDG_EMBLEMS);
@@ -1028,6 +1355,98 @@ static void gnui_emblem_picker_repage_view (
 }
 
 
+/**
+
+    gnui_emblem_picker_apply_emblem_state:
+    @self:              (not nullable): The emblem picker
+    @priv:              (not nullable): The emblem picker's private `struct`
+    @emblem_name:       (not nullable): The name of the emblem to set
+    @state:             The state to assign to the emblem
+    @add_if_missing:    If `true`, create the emblem when the emblem is not
+                        found
+
+    Set the current state of an emblem, without updating the
+    #GnuiEmblemPicker:modified property
+
+    Returns:    `true` if the emblem state was set, `false` otherwise
+
+**/
+static bool gnui_emblem_picker_apply_emblem_state (
+	GnuiEmblemPicker * const self,
+	GnuiEmblemPickerPrivate * const priv,
+	const gchar * const emblem_name,
+	const GnuiEmblemState state,
+	const bool add_if_missing
+) {
+
+	GnuiEmblemPickerReference * emref =
+		g_hash_table_lookup(priv->reference_index, emblem_name);
+
+	if (emref) {
+
+		if (
+			state == GNUI_EMBLEM_STATE_INCONSISTENT &&
+			!emref->inconsistent_files
+		) {
+
+			return false;
+
+		}
+
+		gnui_emblem_picker_reference_change_state(priv, emref, state);
+		gnui_emblem_picker_refresh_cell(emref);
+		return true;
+
+	}
+
+	if (
+		!add_if_missing || (
+			self->forbidden_emblems && g_strv_contains(
+				(const gchar * const *) self->forbidden_emblems,
+				emblem_name
+			)
+		)
+	) {
+
+		return false;
+
+	}
+
+	emref = g_object_new(GNUI_TYPE_EMBLEM_PICKER_REFERENCE, NULL);
+	emref->name = g_strdup(emblem_name);
+	emref->inconsistent_group = NULL;
+	emref->saved_state = emref->current_state = GNUI_EMBLEM_STATE_NORMAL;
+	gnui_emblem_picker_reference_change_state(priv, emref, state);
+	emref->unsupported = true;
+
+	priv->references = g_list_insert_sorted_with_data(
+		priv->references,
+		emref,
+		(GCompareDataFunc) gnui_emblem_picker_sort_emblem_references,
+		NULL
+	);
+
+	g_hash_table_insert(priv->reference_index, emref->name, emref);
+
+	g_list_store_insert_sorted(
+		priv->pages[PAGE_UNSUPPORTED].emblem_store,
+		emref,
+		(GCompareDataFunc) gnui_emblem_picker_sort_emblem_references,
+		NULL
+	);
+
+	if (priv->is_single_page) {
+
+		priv->is_single_page = false;
+		gnui_emblem_picker_repage_view(self, priv);
+
+	}
+
+	return true;
+
+}
+
+
 /**
 
     gnui_emblem_picker_refresh_icons:
@@ -1050,7 +1469,7 @@ static void gnui_emblem_picker_refresh_icons (
 		* refllnk = old_refs,
 		* namellnk;
 
-	EmblemReference * emref;
+	GnuiEmblemPickerReference * emref;
 	bool has_one_page = true;
 
 	review_old_stack: if (refllnk) {
@@ -1066,6 +1485,7 @@ static void gnui_emblem_picker_refresh_icons (
 			)
 		) {
 
+			priv->n_modified -= emref->current_state != emref->saved_state;
 			refllnk = refllnk->next;
 			goto review_old_stack;
 
@@ -1087,20 +1507,8 @@ static void gnui_emblem_picker_refresh_icons (
 			g_free(namellnk->data);
 			new_stack = g_list_delete_link(new_stack, namellnk);
 
-			if (emref->unsupported) {
-
-				/*  New stack supports the emblem: make it visual  */
-
-				gtk_flow_box_remove(
-					GTK_FLOW_BOX(priv->pages[PAGE_UNSUPPORTED].emblem_view),
-					emref->controller_cell
-				);
-
-				emref->unsupported = false;
-				gnui_emblem_picker_draw_supported_emblem(self, priv, emref);
-
-			}
-
+			/*  If the new stack supports the emblem make it visual  */
+			emref->unsupported = false;
 			goto add_and_continue;
 
 		}
@@ -1117,20 +1525,8 @@ static void gnui_emblem_picker_refresh_icons (
 
 		}
 
-		if (!emref->unsupported) {
-
-			/*  New stack doesn't support the toggled emblem: textualize it  */
-
-			gtk_flow_box_remove(
-				GTK_FLOW_BOX(priv->pages[PAGE_SUPPORTED].emblem_view),
-				emref->controller_cell
-			);
-
-			emref->unsupported = true;
-			gnui_emblem_picker_draw_unsupported_emblem(self, priv, emref);
-
-		}
-
+		/*  New stack doesn't support the toggled emblem: textualize it  */
+		emref->unsupported = true;
 		has_one_page = false;
 
 
@@ -1154,12 +1550,11 @@ static void gnui_emblem_picker_refresh_icons (
 
 	while (namellnk) {
 
-		emref = g_new(EmblemReference, 1);
+		emref = g_object_new(GNUI_TYPE_EMBLEM_PICKER_REFERENCE, NULL);
 		emref->name = namellnk->data;
 		emref->unsupported = false;
 		emref->inconsistent_group = NULL;
 		emref->saved_state = emref->current_state = GNUI_EMBLEM_STATE_NORMAL;
-		gnui_emblem_picker_draw_supported_emblem(self, priv, emref);
 		refllnk = namellnk;
 		namellnk = namellnk->next;
 		refllnk->data = emref;
@@ -1174,114 +1569,1248 @@ static void gnui_emblem_picker_refresh_icons (
 	}
 
 	priv->is_single_page = has_one_page;
+	gnui_emblem_picker_index_references(priv);
 
-	for (
-		refllnk = old_refs;
-			refllnk;
-		gnui_emblem_picker_reference_destroy(priv, refllnk->data),
-		refllnk = refllnk->next
-	);
-
-	g_list_free(old_refs);
-
-	priv->references = g_list_sort(
-		priv->references,
-		(GCompareFunc) gnui_emblem_picker_sort_emblem_references
-	);
-
-	refllnk = priv->references;
+	gnui_emblem_picker_restock_views(priv);
+	g_list_free_full(old_refs, g_object_unref);
 	gnui_emblem_picker_repage_view(self, priv);
 
-}
-
+	/*  Dropped emblems might have been the only modified ones  */
+	gnui_emblem_picker_update_modified(self, priv);
 
-/*  Event listeners  */
+}
 
 
 /**
 
-    gnui_emblem_picker__on_emblem_toggle:
-    @emblem_view:   (auto) (unused): The `GtkFlowBox` child
-    @emblem_widget: (auto) (not nullable): The `GnuiEmblemPickerEmblem` GObject
-                    passed as `GtkFlowBoxChild`
-    @v_self:        (auto) (not nullable): The emblem picker passed as
-                    `gpointer`
+    gnui_emblem_picker_loader_free:
+    @loader:    (not nullable): The emblem loader
 
-    Event handler for the #GtkFlowBox::child-activated event of the emblem
-    picker's `GtkFlowBox`
+    Free an emblem loader
 
 **/
-static void gnui_emblem_picker__on_emblem_toggle (
-	G_GNUC_UNUSED GtkFlowBox * const emblem_view,
-	GtkFlowBoxChild * const emblem_widget,
-	const gpointer v_self
+static void gnui_emblem_picker_loader_free (
+	GnuiEmblemPickerLoader * const loader
 ) {
 
-	gnui_emblem_picker_toggle_emblem_reference(
-		v_self,
-		GNUI_EMBLEM_PICKER_EMBLEM(emblem_widget)->emref
-	);
+	for (gsize file_idx = 0; file_idx < loader->n_files; file_idx++) {
+
+		g_object_unref(loader->files[file_idx]);
+
+	}
+
+	g_free(loader->files);
+	g_free(loader->read_files);
+	g_object_unref(loader->backend);
+	g_hash_table_unref(loader->assignments);
+	g_object_unref(loader->cancellable);
+	g_free(loader);
 
 }
 
 
 /**
 
-    gnui_emblem_picker__on_navigate_click:
-    @nav_button:    (auto) (unused): Navigation `GtkButton`
-    @v_target_page: (auto) (not nullable): The `GnuiEmblemPickerPage` of
-                    destination passed as `gpointer`
+    gnui_emblem_picker_abandon_loader:
+    @priv:      (not nullable): The emblem picker's private `struct`
 
-    Event handler for the #GtkButton::clicked event of the emblem picker's
+    Cancel the emblem loading session in progress (if any) and detach it from
+    the emblem picker
+
+    The loader will free itself when its last pending batch returns.
+
+**/
+static void gnui_emblem_picker_abandon_loader (
+	GnuiEmblemPickerPrivate * const priv
+) {
+
+	if (priv->loader) {
+
+		priv->loader->picker = NULL;
+		g_cancellable_cancel(priv->loader->cancellable);
+		priv->loader = NULL;
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_picker_update_sensitivity:
+    @priv:      (not nullable): The emblem picker's private `struct`
+
+    Make the emblem views insensitive while the emblems are being loaded or
+    saved, and sensitive otherwise
+
+**/
+static void gnui_emblem_picker_update_sensitivity (
+	GnuiEmblemPickerPrivate * const priv
+) {
+
+	for (
+		GnuiEmblemPickerPageNum page_num = 0;
+			page_num < N_EMBLEM_PICKER_PAGES;
+		page_num++
+	) {
+
+		gtk_widget_set_sensitive(
+			priv->pages[page_num].emblem_view,
+			!priv->loader && !priv->saver
+		);
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_picker_update_loading:
+    @self:      (not nullable): The emblem picker
+    @priv:      (not nullable): The emblem picker's private `struct`
+
+    Update the emblem views' sensitivity after a loading session has started
+    or ended and notify #GnuiEmblemPicker:loading
+
+**/
+static void gnui_emblem_picker_update_loading (
+	GnuiEmblemPicker * const self,
+	GnuiEmblemPickerPrivate * const priv
+) {
+
+	gnui_emblem_picker_update_sensitivity(priv);
+	g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_LOADING]);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_loader_finish:
+    @loader:    (not nullable): The emblem loader
+
+    Assign the final states to the emblem references after all the mapped
+    files have been read (or the loading has been cancelled), add the emblems
+    that are not supported by the theme and free the loader
+
+**/
+static void gnui_emblem_picker_loader_finish (
+	GnuiEmblemPickerLoader * const loader
+) {
+
+	GnuiEmblemPicker * const self = loader->picker;
+
+	GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(self);
+
+	GHashTableIter iter;
+	const gchar * emblem_name;
+	gpointer quark;
+	guint64 * owners;
+	GnuiEmblemPickerReference * emref;
+	bool has_unsupported = false;
+
+	g_hash_table_iter_init(&iter, loader->assignments);
+
+	while (g_hash_table_iter_next(&iter, &quark, (gpointer *) &owners)) {
+
+		g_hash_table_iter_steal(&iter);
+		emblem_name = g_quark_to_string(GPOINTER_TO_UINT(quark));
+
+		if ((emref = g_hash_table_lookup(priv->reference_index, emblem_name))) {
+
+			gnui_emblem_picker_reference_set_owners(
+				emref,
+				owners,
+				loader->n_files
+			);
+
+			continue;
+
+		}
+
+		/*  Emblems assigned to the files but not supported by the theme  */
+
+		if (
+			self->forbidden_emblems && g_strv_contains(
+				(const gchar * const *) self->forbidden_emblems,
+				emblem_name
+			)
+		) {
+
+			g_free(owners);
+			continue;
+
+		}
+
+		emref = g_object_new(GNUI_TYPE_EMBLEM_PICKER_REFERENCE, NULL);
+		emref->unsupported = true;
+		emref->name = g_strdup(emblem_name);
+		gnui_emblem_picker_reference_set_owners(emref, owners, loader->n_files);
+		priv->references = g_list_prepend(priv->references, emref);
+		g_hash_table_insert(priv->reference_index, emref->name, emref);
+		has_unsupported = true;
+
+	}
+
+	if (
+		gnui_bitset_count(loader->read_files, loader->n_files) <
+			loader->n_files
+	) {
+
+		/*  Cancelled or failed: the unread files must never be written  */
+		priv->read_files = g_steal_pointer(&loader->read_files);
+
+	}
+
+	priv->loader = NULL;
+	priv->is_single_page &= !has_unsupported;
+	gnui_emblem_picker_restock_views(priv);
+	gnui_emblem_picker_repage_view(self, priv);
+	gnui_emblem_picker_update_loading(self, priv);
+	gnui_emblem_picker_loader_free(loader);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_run_batch:
+    @batch:         (not nullable): The batch to hand to the emblem backend
+    @cancellable:   (not nullable): The session's `GCancellable`
+    @thread_func:   (not nullable): The function to run in a worker thread
+    @on_done:       (not nullable): The function to call in the main context
+                    when the batch is done (it receives @batch as user data)
+
+    Hand a batch of files to the emblem backend from a worker thread
+
+**/
+static void gnui_emblem_picker_run_batch (
+	GnuiEmblemPickerBatch * const batch,
+	GCancellable * const cancellable,
+	const GTaskThreadFunc thread_func,
+	const GAsyncReadyCallback on_done
+) {
+
+	GTask * const task = g_task_new(NULL, cancellable, on_done, batch);
+
+	g_task_set_task_data(task, batch, NULL);
+	g_task_run_in_thread(task, thread_func);
+	g_object_unref(task);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_batch_free:
+    @batch:     (transfer full) (not nullable): The batch
+
+    Free a batch of files once its results have been consumed (what the
+    backend returned is freed by the caller)
+
+**/
+static void gnui_emblem_picker_batch_free (
+	GnuiEmblemPickerBatch * const batch
+) {
+
+	if (batch->jobs) {
+
+		/*  Write batches own their arrays of locations and jobs  */
+		g_free(batch->locations);
+		g_free(batch->jobs);
+
+	}
+
+	g_object_unref(batch->backend);
+	g_free(batch->emblems);
+	g_free(batch->errors);
+	g_free(batch);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_loader_dispatch:
+    @loader:    (not nullable): The emblem loader
+    @on_read:   (not nullable): The completion handler of the batches
+
+    Hand new batches of files to the emblem backend until
+    %GNUI_EMBLEM_PICKER_MAX_PENDING_BATCHES are in flight
+
+**/
+static void gnui_emblem_picker_loader_dispatch (
+	GnuiEmblemPickerLoader * const loader,
+	const GAsyncReadyCallback on_read
+) {
+
+	GnuiEmblemPickerBatch * batch;
+
+	while (
+		!g_cancellable_is_cancelled(loader->cancellable) &&
+		loader->next_file < loader->n_files &&
+		loader->n_pending < GNUI_EMBLEM_PICKER_MAX_PENDING_BATCHES
+	) {
+
+		batch = g_new(GnuiEmblemPickerBatch, 1);
+		batch->session = loader;
+		batch->backend = g_object_ref(loader->backend);
+		batch->first = loader->next_file;
+
+		batch->n_files = MIN(
+			loader->n_files - loader->next_file,
+			GNUI_EMBLEM_PICKER_BATCH_SIZE
+		);
+
+		batch->locations = loader->files + batch->first;
+		batch->emblems = g_new0(gchar **, batch->n_files);
+		batch->errors = g_new0(GError *, batch->n_files);
+		batch->jobs = NULL;
+		loader->next_file += batch->n_files;
+		loader->n_pending++;
+
+		gnui_emblem_picker_run_batch(
+			batch,
+			loader->cancellable,
+			gnui_emblem_picker_read_batch_in_thread,
+			on_read
+		);
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_picker_names_from_bitset:
+    @bitset:    (not nullable): A bitset over the indices of @emrefs
+    @n_words:   The size of @bitset in `guint64` words
+    @n_names:   The number of bits that are set in @bitset
+    @emrefs:    (not nullable): The emblem references, by index
+
+    Collect the names of the emblems whose bit is set in a bitset
+
+    Returns:    (transfer container) (nullable): A `NULL`-terminated array of
+                names borrowed from @emrefs, or `NULL` if @n_names is zero
+
+**/
+static const gchar ** gnui_emblem_picker_names_from_bitset (
+	const guint64 * const bitset,
+	const gsize n_words,
+	const gsize n_names,
+	GnuiEmblemPickerReference * const * const emrefs
+) {
+
+	if (!n_names) {
+
+		return NULL;
+
+	}
+
+	const gchar ** const names = g_new(const gchar *, n_names + 1);
+	gsize idx = 0;
+	guint64 word;
+
+	for (gsize word_idx = 0; word_idx < n_words; word_idx++) {
+
+		for (word = bitset[word_idx]; word; word &= word - 1) {
+
+			names[idx++] =
+				emrefs[word_idx * 64 + __builtin_ctzll(word)]->name;
+
+		}
+
+	}
+
+	names[idx] = NULL;
+	return names;
+
+}
+
+
+/**
+
+    gnui_emblem_picker_plan_save:
+    @self:      (not nullable): The emblem picker
+    @priv:      (not nullable): The emblem picker's private `struct`
+    @flags:     The flags the save was requested with
+    @n_jobs:    (out) (not nullable): The number of jobs planned
+
+    Compute what must be written into each mapped file
+
+    The old and the new emblems of each file are bitsets over the indices of
+    the emblem references: the emblems that are selected (or not selected)
+    for every file are computed once, and only the references that are
+    inconsistent are looked up for each file. Nothing is allocated for the
+    files that need no writes.
+
+    Returns:    (transfer full): An array of @n_jobs save jobs, one for each
+                mapped file, in the order of #GnuiEmblemPicker:mapped-files
+
+**/
+static GnuiEmblemPickerSaveJob * gnui_emblem_picker_plan_save (
+	const GnuiEmblemPicker * const self,
+	const GnuiEmblemPickerPrivate * const priv,
+	const GnuiEmblemPickerSaveFlags flags,
+	gsize * const n_jobs
+) {
+
+	const gsize n_refs = g_list_length(priv->references);
+	const gsize n_words = GNUI_BITSET_N_WORDS(n_refs);
+
+	GnuiEmblemPickerSaveJob * const jobs = g_new(
+		GnuiEmblemPickerSaveJob,
+		g_list_length(self->mapped_files)
+	);
+
+	GnuiEmblemPickerReference ** const emrefs =
+		g_new(GnuiEmblemPickerReference *, n_refs);
+
+	/*  The references that are inconsistent either now or when saved  */
+	gsize * const mixed = g_new(gsize, n_refs);
+
+	guint64 * const bitsets = g_new0(guint64, n_words * 4);
+	guint64 * const new_for_all = bitsets;
+	guint64 * const old_for_all = bitsets + n_words;
+	guint64 * const new_set = bitsets + n_words * 2;
+	guint64 * const old_set = bitsets + n_words * 3;
+
+	const GList * llnk;
+	GnuiEmblemPickerSaveJob * job;
+	GnuiEmblemPickerReference * emref;
+	guint64 diff;
+	gsize ref_idx, n_mixed = 0, file_idx = 0, n_new, n_added, n_removed;
+
+	for (
+		llnk = priv->references, ref_idx = 0;
+			llnk;
+		llnk = llnk->next, ref_idx++
+	) {
+
+		emref = emrefs[ref_idx] = llnk->data;
+
+		if (emref->current_state == GNUI_EMBLEM_STATE_SELECTED) {
+
+			gnui_bitset_add(new_for_all, ref_idx);
+
+		}
+
+		if (emref->saved_state == GNUI_EMBLEM_STATE_SELECTED) {
+
+			gnui_bitset_add(old_for_all, ref_idx);
+
+		}
+
+		if (
+			emref->current_state == GNUI_EMBLEM_STATE_INCONSISTENT ||
+			emref->saved_state == GNUI_EMBLEM_STATE_INCONSISTENT
+		) {
+
+			mixed[n_mixed++] = ref_idx;
+
+		}
+
+	}
+
+	for (
+		llnk = self->mapped_files;
+			llnk;
+		llnk = llnk->next, file_idx++
+	) {
+
+		memcpy(new_set, new_for_all, n_words * sizeof(guint64));
+		memcpy(old_set, old_for_all, n_words * sizeof(guint64));
+
+		for (gsize mixed_idx = 0; mixed_idx < n_mixed; mixed_idx++) {
+
+			emref = emrefs[ref_idx = mixed[mixed_idx]];
+
+			if (!gnui_bitset_contains(emref->inconsistent_files, file_idx)) {
+
+				continue;
+
+			}
+
+			if (emref->current_state == GNUI_EMBLEM_STATE_INCONSISTENT) {
+
+				gnui_bitset_add(new_set, ref_idx);
+
+			}
+
+			if (emref->saved_state == GNUI_EMBLEM_STATE_INCONSISTENT) {
+
+				gnui_bitset_add(old_set, ref_idx);
+
+			}
+
+		}
+
+		n_new = n_added = n_removed = 0;
+
+		for (gsize word_idx = 0; word_idx < n_words; word_idx++) {
+
+			diff = new_set[word_idx] ^ old_set[word_idx];
+			n_new += __builtin_popcountll(new_set[word_idx]);
+			n_added += __builtin_popcountll(diff & new_set[word_idx]);
+			n_removed += __builtin_popcountll(diff & old_set[word_idx]);
+
+			/*  Keep only the differences (`new_set` keeps the whole set)  */
+			old_set[word_idx] = diff;
+
+		}
+
+		job = jobs + file_idx;
+		job->saver = NULL;
+		job->location = g_object_ref(llnk->data);
+
+		job->is_unknown =
+			priv->read_files &&
+			!gnui_bitset_contains(priv->read_files, file_idx);
+
+		if (
+			job->is_unknown || (
+				!n_added &&
+				!n_removed &&
+				!(flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_SAVE_UNMODIFIED)
+			)
+		) {
+
+			job->emblems = NULL;
+			job->additions = NULL;
+			job->removals = NULL;
+			continue;
+
+		}
+
+		job->emblems = gnui_emblem_picker_names_from_bitset(
+			new_set,
+			n_words,
+			n_new,
+			emrefs
+		);
+
+		for (gsize word_idx = 0; word_idx < n_words; word_idx++) {
+
+			/*  `old_set` becomes the removals, `new_set` the additions  */
+			diff = old_set[word_idx];
+			old_set[word_idx] = diff & ~new_set[word_idx];
+			new_set[word_idx] &= diff;
+
+		}
+
+		job->additions = gnui_emblem_picker_names_from_bitset(
+			new_set,
+			n_words,
+			n_added,
+			emrefs
+		);
+
+		job->removals = gnui_emblem_picker_names_from_bitset(
+			old_set,
+			n_words,
+			n_removed,
+			emrefs
+		);
+
+	}
+
+	g_free(bitsets);
+	g_free(mixed);
+	g_free(emrefs);
+	*n_jobs = file_idx;
+	return jobs;
+
+}
+
+
+/**
+
+    gnui_emblem_picker_free_save_jobs:
+    @jobs:      (transfer full) (not nullable): An array of save jobs
+    @n_jobs:    The number of jobs in @jobs
+
+    Free an array of save jobs
+
+**/
+static void gnui_emblem_picker_free_save_jobs (
+	GnuiEmblemPickerSaveJob * const jobs,
+	const gsize n_jobs
+) {
+
+	for (gsize idx = 0; idx < n_jobs; idx++) {
+
+		g_object_unref(jobs[idx].location);
+		g_free(jobs[idx].emblems);
+		g_free(jobs[idx].additions);
+		g_free(jobs[idx].removals);
+
+	}
+
+	g_free(jobs);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_commit_saved_states:
+    @self:      (not nullable): The emblem picker
+    @priv:      (not nullable): The emblem picker's private `struct`
+    @flags:     The flags the save was requested with
+
+    Make the current emblem states the saved ones after a successful save
+
+**/
+static void gnui_emblem_picker_commit_saved_states (
+	GnuiEmblemPicker * const self,
+	GnuiEmblemPickerPrivate * const priv,
+	const GnuiEmblemPickerSaveFlags flags
+) {
+
+	const GList * refllnk;
+	GnuiEmblemPickerReference * emref;
+
+	if (flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_CLEAN_INCONSISTENCY) {
+
+		for (refllnk = priv->references; refllnk; refllnk = refllnk->next) {
+
+			emref = refllnk->data;
+			emref->saved_state = emref->current_state;
+			g_clear_pointer(&emref->inconsistent_files, g_free);
+			g_clear_pointer(&emref->inconsistent_group, g_list_free);
+
+		}
+
+	} else {
+
+		for (refllnk = priv->references; refllnk; refllnk = refllnk->next) {
+
+			((GnuiEmblemPickerReference *) refllnk->data)->saved_state =
+				((GnuiEmblemPickerReference *) refllnk->data)->current_state;
+
+		}
+
+	}
+
+	priv->n_modified = 0;
+
+	if (self->modified) {
+
+		self->modified = false;
+		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_MODIFIED]);
+		g_signal_emit(self, signals[SIGNAL_MODIFIED_CHANGED], 0, false);
+
+	}
+
+	if (~flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_DONT_REFRESH) {
+
+		for (refllnk = priv->references; refllnk; refllnk = refllnk->next) {
+
+			gnui_emblem_picker_refresh_cell(refllnk->data);
+
+		}
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_picker_saver_free:
+    @v_saver:   (transfer full) (not nullable): The save session passed as
+                `gpointer`
+
+    Free a save session (`GDestroyNotify` of the session's `GTask` data)
+
+**/
+static void gnui_emblem_picker_saver_free (
+	const gpointer v_saver
+) {
+
+	GnuiEmblemPickerSaver * const saver = v_saver;
+
+	gnui_emblem_picker_free_save_jobs(saver->jobs, saver->n_jobs);
+	g_list_free_full(saver->references, g_object_unref);
+	g_object_unref(saver->backend);
+	g_clear_error(&saver->error);
+	g_object_unref(saver->cancellable);
+	g_free(saver);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_abandon_saver:
+    @priv:      (not nullable): The emblem picker's private `struct`
+
+    Detach the save session in progress (if any) from the emblem picker
+
+**/
+static void gnui_emblem_picker_abandon_saver (
+	GnuiEmblemPickerPrivate * const priv
+) {
+
+	if (priv->saver) {
+
+		priv->saver->picker = NULL;
+		priv->saver = NULL;
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_picker_saver_report:
+    @saver:     (not nullable): The save session
+    @job:       (not nullable): The job that has been carried out
+    @result:    The result of the job
+    @error:     (nullable): The error, if @result is
+                `GNUI_EMBLEM_PICKER_ERROR`
+
+    Count the result of a save job, invoke the user-given callback and decide
+    whether the save session must be aborted
+
+**/
+static void gnui_emblem_picker_saver_report (
+	GnuiEmblemPickerSaver * const saver,
+	const GnuiEmblemPickerSaveJob * const job,
+	const GnuiEmblemPickerSaveResult result,
+	const GError * const error
+) {
+
+	GnuiEmblemPickerSaveFlags fmatch;
+
+	switch (result) {
+
+		case GNUI_EMBLEM_PICKER_SUCCESS:
+
+			saver->n_saved++;
+			fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_SUCCESS;
+			break;
+
+		case GNUI_EMBLEM_PICKER_ERROR:
+
+			saver->n_failed++;
+			fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_ERROR;
+			break;
+
+		default:
+
+			saver->n_unchanged++;
+			fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_NOACTION;
+
+	}
+
+	if (
+		(
+			saver->for_each_file &&
+			(saver->flags & fmatch) &&
+			!saver->for_each_file(
+				job->location,
+				job->additions,
+				job->removals,
+				result,
+				error,
+				saver->for_each_data
+			)
+		) || (
+			result == GNUI_EMBLEM_PICKER_ERROR &&
+			(saver->flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_ABORT_MODE)
+		)
+	) {
+
+		if (error) {
+
+			saver->error = g_error_copy(error);
+
+		}
+
+		/*  Stop the writes that are still in flight  */
+		saver->aborted = true;
+		g_cancellable_cancel(saver->cancellable);
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_picker_saver_complete:
+    @saver:     (not nullable): The save session
+
+    Conclude a save session after its last pending write has returned
+
+**/
+static void gnui_emblem_picker_saver_complete (
+	GnuiEmblemPickerSaver * const saver
+) {
+
+	GTask * const task = saver->task;
+	GnuiEmblemPickerPrivate * priv;
+
+	if (saver->picker) {
+
+		priv = gnui_emblem_picker_get_instance_private(saver->picker);
+		priv->saver = NULL;
+		gnui_emblem_picker_update_sensitivity(priv);
+
+		if (
+			!saver->aborted &&
+			!g_cancellable_is_cancelled(saver->cancellable)
+		) {
+
+			gnui_emblem_picker_commit_saved_states(
+				saver->picker,
+				priv,
+				saver->flags
+			);
+
+		}
+
+	}
+
+	g_cancellable_disconnect(saver->user_cancellable, saver->cancel_handler);
+
+	if (saver->error) {
+
+		g_task_return_error(task, g_steal_pointer(&saver->error));
+
+	} else if (!g_task_return_error_if_cancelled(task)) {
+
+		g_task_return_boolean(task, !saver->aborted);
+
+	}
+
+	g_object_unref(task);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_saver_dispatch:
+    @saver:         (not nullable): The save session
+    @on_written:    (not nullable): The completion handler of the batches
+
+    Carry on a save session: hand new batches of writes to the emblem backend
+    until %GNUI_EMBLEM_PICKER_MAX_PENDING_BATCHES are in flight, report the
+    files that need no writes, and conclude the session when nothing is left
+
+**/
+static void gnui_emblem_picker_saver_dispatch (
+	GnuiEmblemPickerSaver * const saver,
+	const GAsyncReadyCallback on_written
+) {
+
+	GnuiEmblemPickerSaveJob * job;
+	GnuiEmblemPickerBatch * batch = NULL;
+
+	while (
+		!saver->aborted &&
+		!g_cancellable_is_cancelled(saver->cancellable) &&
+		saver->next_job < saver->n_jobs &&
+		saver->n_pending < GNUI_EMBLEM_PICKER_MAX_PENDING_BATCHES
+	) {
+
+		job = saver->jobs + saver->next_job++;
+
+		if (!gnui_emblem_picker_save_job_needs_write(job, saver->flags)) {
+
+			gnui_emblem_picker_saver_report(
+				saver,
+				job,
+				GNUI_EMBLEM_PICKER_NOACTION,
+				NULL
+			);
+
+			continue;
+
+		}
+
+		if (!batch) {
+
+			batch = g_new(GnuiEmblemPickerBatch, 1);
+			batch->session = saver;
+			batch->backend = g_object_ref(saver->backend);
+			batch->locations = g_new(GFile *, GNUI_EMBLEM_PICKER_BATCH_SIZE);
+			batch->emblems = g_new(gchar **, GNUI_EMBLEM_PICKER_BATCH_SIZE);
+			batch->errors = g_new0(GError *, GNUI_EMBLEM_PICKER_BATCH_SIZE);
+
+			batch->jobs =
+				g_new(GnuiEmblemPickerSaveJob *, GNUI_EMBLEM_PICKER_BATCH_SIZE);
+
+			batch->first = saver->next_job - 1;
+			batch->n_files = 0;
+
+		}
+
+		batch->locations[batch->n_files] = job->location;
+		batch->emblems[batch->n_files] = (gchar **) job->emblems;
+		batch->jobs[batch->n_files] = job;
+
+		if (++batch->n_files == GNUI_EMBLEM_PICKER_BATCH_SIZE) {
+
+			saver->n_pending++;
+
+			gnui_emblem_picker_run_batch(
+				g_steal_pointer(&batch),
+				saver->cancellable,
+				gnui_emblem_picker_write_batch_in_thread,
+				on_written
+			);
+
+		}
+
+	}
+
+	if (
+		batch && (
+			saver->aborted ||
+			g_cancellable_is_cancelled(saver->cancellable)
+		)
+	) {
+
+		/*  The session was stopped while the batch was being gathered  */
+		gnui_emblem_picker_batch_free(batch);
+
+	} else if (batch) {
+
+		/*  The jobs are over (the last ones might have needed no writes),
+			but a partly filled batch is still waiting to be written  */
+
+		saver->n_pending++;
+
+		gnui_emblem_picker_run_batch(
+			batch,
+			saver->cancellable,
+			gnui_emblem_picker_write_batch_in_thread,
+			on_written
+		);
+
+	}
+
+	if (!saver->n_pending) {
+
+		gnui_emblem_picker_saver_complete(saver);
+
+	}
+
+}
+
+
+/*  Event listeners  */
+
+
+/**
+
+    gnui_emblem_picker__on_emblem_toggle:
+    @emblem_cell:   (auto) (not nullable): The `GnuiEmblemPickerEmblem`
+                    passed as `GtkButton`
+    @v_self:        (auto) (not nullable): The emblem picker passed as
+                    `gpointer`
+
+    Event handler for the #GtkButton::clicked event of the emblem picker's
+    cells
+
+**/
+static void gnui_emblem_picker__on_emblem_toggle (
+	GtkButton * const emblem_cell,
+	const gpointer v_self
+) {
+
+	GnuiEmblemPickerReference * const emref =
+		GNUI_EMBLEM_PICKER_EMBLEM(emblem_cell)->emref;
+
+	if (emref) {
+
+		gnui_emblem_picker_toggle_emblem_reference(v_self, emref);
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_picker__on_navigate_click:
+    @nav_button:    (auto) (unused): Navigation `GtkButton`
+    @v_target_page: (auto) (not nullable): The `GnuiEmblemPickerPage` of
+                    destination passed as `gpointer`
+
+    Event handler for the #GtkButton::clicked event of the emblem picker's
     navigation buttons
 
 **/
-static void gnui_emblem_picker__on_navigate_click (
-	GtkButton * const nav_button G_GNUC_UNUSED,
-	const gpointer v_target_page
+static void gnui_emblem_picker__on_navigate_click (
+	GtkButton * const nav_button G_GNUC_UNUSED,
+	const gpointer v_target_page
+) {
+
+	#define target_page ((const GnuiEmblemPickerPage *) v_target_page)
+
+	adw_leaflet_navigate(target_page->pager, target_page->way_in);
+	gtk_widget_child_focus(target_page->emblem_view, GTK_DIR_TAB_FORWARD);
+
+	#undef target_page
+
+}
+
+
+/**
+
+    gnui_emblem_picker__on_icon_theme_change:
+    @theme:         (auto) (not nullable): The current display's icon theme
+    @v_self:        (auto) (not nullable): The emblem picker passed as
+                    `gpointer`
+
+    Event handler for the #GtkIconTheme::changed event of the icon theme
+
+**/
+static void gnui_emblem_picker__on_icon_theme_change (
+	GtkIconTheme * const theme,
+	const gpointer v_self
+) {
+
+	GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(v_self);
+
+	priv->icon_theme = theme;
+	gnui_emblem_picker_refresh_icons(v_self, priv);
+
+}
+
+
+/**
+
+    gnui_emblem_picker__on_batch_read:
+    @source:        (auto) (unused): The task's source object
+    @result:        (auto) (not nullable): The result of the batch
+    @v_batch:       (auto) (not nullable): The `GnuiEmblemPickerBatch`
+                    passed as `gpointer`
+
+    Completion handler of the batches of files read by an emblem loader
+
+    Each completed batch makes room for the next one, so that no more than
+    %GNUI_EMBLEM_PICKER_MAX_PENDING_BATCHES batches are read at the same time.
+
+**/
+static void gnui_emblem_picker__on_batch_read (
+	GObject * const source G_GNUC_UNUSED,
+	GAsyncResult * const result G_GNUC_UNUSED,
+	const gpointer v_batch
+) {
+
+	GnuiEmblemPickerBatch * const batch = v_batch;
+	GnuiEmblemPickerLoader * const loader = batch->session;
+	GnuiEmblemPickerReference * emref;
+	gchar * uri;
+	gchar ** file_emblems;
+	gpointer quark;
+	guint64 * owners;
+
+	GnuiEmblemPickerPrivate * const priv =
+		loader->picker ?
+			gnui_emblem_picker_get_instance_private(loader->picker)
+		:
+			NULL;
+
+	loader->n_pending--;
+
+	for (gsize idx = 0; idx < batch->n_files; idx++) {
+
+		if (!loader->picker) {
+
+			/*  The loader has been abandoned  */
+
+		} else if (batch->errors[idx]) {
+
+			if (
+				!g_error_matches(
+					batch->errors[idx],
+					G_IO_ERROR,
+					G_IO_ERROR_CANCELLED
+				)
+			) {
+
+				uri = g_file_get_uri(batch->locations[idx]);
+
+				g_warning(
+					"%s (%s) // %s",
+					_("Could not read file's emblems"),
+					uri ? uri : _("unknown location"),
+					batch->errors[idx]->message
+				);
+
+				g_free(uri);
+
+			}
+
+		} else if ((file_emblems = batch->emblems[idx])) {
+
+			while (*file_emblems) {
+
+				quark = GUINT_TO_POINTER(g_quark_from_string(*file_emblems));
+
+				if (
+					!(owners = g_hash_table_lookup(loader->assignments, quark))
+				) {
+
+					owners = g_new0(guint64, loader->n_words);
+					g_hash_table_insert(loader->assignments, quark, owners);
+
+				}
+
+				gnui_bitset_add(owners, batch->first + idx);
+
+				/*  Until all the files are read no emblem can be "selected"  */
+
+				if (
+					(emref = g_hash_table_lookup(
+						priv->reference_index,
+						*file_emblems
+					)) && emref->current_state == GNUI_EMBLEM_STATE_NORMAL
+				) {
+
+					emref->saved_state = emref->current_state =
+						GNUI_EMBLEM_STATE_INCONSISTENT;
+
+					gnui_emblem_picker_refresh_cell(emref);
+
+				}
+
+				file_emblems++;
+
+			}
+
+		}
+
+		if (loader->picker && !batch->errors[idx]) {
+
+			gnui_bitset_add(loader->read_files, batch->first + idx);
+
+		}
+
+		g_clear_error(batch->errors + idx);
+		g_strfreev(batch->emblems[idx]);
+
+	}
+
+	gnui_emblem_picker_batch_free(batch);
+
+	if (!loader->picker) {
+
+		if (!loader->n_pending) {
+
+			gnui_emblem_picker_loader_free(loader);
+
+		}
+
+		return;
+
+	}
+
+	gnui_emblem_picker_loader_dispatch(
+		loader,
+		gnui_emblem_picker__on_batch_read
+	);
+
+	if (!loader->n_pending) {
+
+		gnui_emblem_picker_loader_finish(loader);
+
+	}
+
+}
+
+
+/**
+
+    gnui_emblem_picker__on_batch_written:
+    @source:        (auto) (unused): The task's source object
+    @result:        (auto) (not nullable): The result of the batch
+    @v_batch:       (auto) (not nullable): The `GnuiEmblemPickerBatch`
+                    passed as `gpointer`
+
+    Completion handler of the batches of files written by a save session
+
+**/
+static void gnui_emblem_picker__on_batch_written (
+	GObject * const source G_GNUC_UNUSED,
+	GAsyncResult * const result G_GNUC_UNUSED,
+	const gpointer v_batch
 ) {
 
-	#define target_page ((const GnuiEmblemPickerPage *) v_target_page)
+	GnuiEmblemPickerBatch * const batch = v_batch;
+	GnuiEmblemPickerSaver * const saver = batch->session;
 
-	adw_leaflet_navigate(target_page->pager, target_page->way_in);
+	saver->n_pending--;
 
-	GtkFlowBoxChild * const first_emblem = gtk_flow_box_get_child_at_index(
-		GTK_FLOW_BOX(target_page->emblem_view),
-		0
-	);
+	for (gsize idx = 0; idx < batch->n_files; idx++) {
+
+		if (saver->aborted || g_cancellable_is_cancelled(saver->cancellable)) {
+
+			/*  The session has been stopped: count, but do not report  */
+
+			if (!batch->errors[idx]) {
+
+				saver->n_saved++;
 
-	if (first_emblem) {
+			}
+
+		} else {
+
+			gnui_emblem_picker_saver_report(
+				saver,
+				batch->jobs[idx],
+				batch->errors[idx] ?
+					GNUI_EMBLEM_PICKER_ERROR
+				:
+					GNUI_EMBLEM_PICKER_SUCCESS,
+				batch->errors[idx]
+			);
 
-		gtk_widget_grab_focus(GTK_WIDGET(first_emblem));
+		}
 
+		g_clear_error(batch->errors + idx);
 
 	}
 
-	#undef target_page
+	gnui_emblem_picker_batch_free(batch);
+
+	gnui_emblem_picker_saver_dispatch(
+		saver,
+		gnui_emblem_picker__on_batch_written
+	);
 
 }
 
 
 /**
 
-    gnui_emblem_picker__on_icon_theme_change:
-    @theme:         (auto) (not nullable): The current display's icon theme
-    @v_self:        (auto) (not nullable): The emblem picker passed as
-                    `gpointer`
+    gnui_emblem_picker__on_save_cancelled:
+    @cancellable:   (auto) (unused): The `GCancellable` passed to
+                    `gnui_emblem_picker_save_async()`
+    @v_saver_cancellable:   (auto) (not nullable): The save session's own
+                            `GCancellable` passed as `gpointer`
 
-    Event handler for the #GtkIconTheme::changed event of the icon theme
+    Event handler for the #GCancellable::cancelled event of the cancellable
+    object passed by the user to `gnui_emblem_picker_save_async()`
 
 **/
-static void gnui_emblem_picker__on_icon_theme_change (
-	GtkIconTheme * const theme,
-	const gpointer v_self
+static void gnui_emblem_picker__on_save_cancelled (
+	GCancellable * const cancellable G_GNUC_UNUSED,
+	const gpointer v_saver_cancellable
 ) {
 
-	GnuiEmblemPickerPrivate * const priv =
-		gnui_emblem_picker_get_instance_private(v_self);
-
-	priv->icon_theme = theme;
-	gnui_emblem_picker_refresh_icons(v_self, priv);
+	g_cancellable_cancel(v_saver_cancellable);
 
 }
 
@@ -1316,7 +2845,7 @@ static void gnui_emblem_picker__on_search_change (
 			gtk_search_entry_get_key_capture_widget(entry)
 	);
 
-	gtk_flow_box_invalidate_filter(GTK_FLOW_BOX(page->emblem_view));
+	gtk_filter_changed(page->emblem_filter, GTK_FILTER_CHANGE_DIFFERENT);
 
 	#undef page
 
@@ -1342,7 +2871,7 @@ static void gnui_emblem_picker__on_search_stop (
 	#define page ((const GnuiEmblemPickerPage *) v_page)
 
 	gtk_revealer_set_reveal_child(GTK_REVEALER(page->search_box), false);
-	gtk_flow_box_invalidate_filter(GTK_FLOW_BOX(page->emblem_view));
+	gtk_filter_changed(page->emblem_filter, GTK_FILTER_CHANGE_DIFFERENT);
 	gtk_widget_grab_focus(gtk_search_entry_get_key_capture_widget(entry));
 
 	#undef page
@@ -1355,252 +2884,324 @@ static void gnui_emblem_picker__on_search_stop (
 
 /**
 
-    gnui_emblem_picker_load_emblems:
-    @self:      (not nullable): The emblem picker
-    @priv:      (not nullable): The emblem picker's private `struct`
+    gnui_emblem_picker_bind_cell:
+    @emblem_cell:   (auto) (not nullable): The emblem cell (a
+                    `GnuiEmblemPickerEmblem` passed as `GtkWidget`)
+    @emref:         (auto) (not nullable): The emblem reference to display
+    @v_self:        (auto) (unused): The emblem picker passed as `gpointer`
+
+    Make an emblem cell display an emblem reference
 
-    Populate the emblem picker's `GtkFlowBox` widgets
+    A cell is bound to one reference at a time and vice versa: whatever link
+    the two had before is broken.
 
 **/
-static void gnui_emblem_picker_load_emblems (
-	GnuiEmblemPicker * const self,
-	GnuiEmblemPickerPrivate * const priv
+static void gnui_emblem_picker_bind_cell (
+	GtkWidget * const emblem_cell,
+	GnuiEmblemPickerReference * const emref,
+	const gpointer v_self G_GNUC_UNUSED
 ) {
 
-	typedef struct _AssignedEmblem {
-		gchar * emblem_name;
-		GList * files;
-	} AssignedEmblem;
+	#define cell GNUI_EMBLEM_PICKER_EMBLEM(emblem_cell)
 
-	GFileInfo * finfo;
-	GError * readerr = NULL;
-	gchar * uri;
-	gchar ** file_emblems;
-	AssignedEmblem * owned_emblem;
-	EmblemReference * emref;
-	GList * assignments = NULL, * assignllnk, * _list_placeholder_1_;
-	gsize file_amount = 0;
+	if (cell->emref) {
 
-	#define filellnk _list_placeholder_1_
+		cell->emref->controller_cell = NULL;
 
-	for (filellnk = self->mapped_files; filellnk; filellnk = filellnk->next) {
+	}
 
-		file_amount++;
+	if (emref->controller_cell) {
 
-		finfo = g_file_query_info(
-			filellnk->data,
-			G_FILE_ATTRIBUTE_METADATA_EMBLEMS,
-			G_FILE_QUERY_INFO_NONE,
-			NULL,
-			&readerr
-		);
+		emref->controller_cell->emref = NULL;
 
-		if (!finfo) {
+	}
 
-			uri = g_file_get_uri(filellnk->data);
+	cell->emref = emref;
+	emref->controller_cell = cell;
 
-			g_warning(
-				"%s (%s) // %s",
-				_("Could not read file's emblems"),
-				uri ? uri : _("unknown location"),
-				readerr->message
-			);
+	if (emref->unsupported) {
 
-			g_free(uri);
-			g_clear_error(&readerr);
-			continue;
+		gtk_label_set_text(GTK_LABEL(cell->face), emref->name);
 
-		}
+	} else {
 
-		if (
-			(file_emblems = g_file_info_get_attribute_stringv(
-				finfo,
-				G_FILE_ATTRIBUTE_METADATA_EMBLEMS
-			))
-		) {
+		gtk_image_set_from_icon_name(GTK_IMAGE(cell->face), emref->name);
+		gtk_widget_set_tooltip_text(cell->face, emref->name);
 
-			while (*file_emblems) {
+	}
 
-				assignllnk = assignments;
+	gnui_emblem_picker_refresh_cell(emref);
 
-				find_file_emblem: if (assignllnk) {
+	#undef cell
 
-					owned_emblem = assignllnk->data;
+}
 
-					if (strcmp(owned_emblem->emblem_name, *file_emblems)) {
 
-						assignllnk = assignllnk->next;
-						goto find_file_emblem;
+/**
 
-					}
+    gnui_emblem_picker_create_supported_cell:
+    @v_self:    (auto) (not nullable): The emblem picker passed as `gpointer`
 
-					owned_emblem->files = g_list_prepend(
-						owned_emblem->files,
-						filellnk->data
-					);
+    Create a cell of the supported emblem view (the cell will be recycled for
+    displaying many emblems)
 
-				} else {
+    Returns:    (transfer floating): The newly created cell
 
-					owned_emblem = g_new(AssignedEmblem, 1);
-					owned_emblem->emblem_name = g_strdup(*file_emblems);
-					owned_emblem->files = g_list_prepend(NULL, filellnk->data);
-					assignments = g_list_prepend(assignments, owned_emblem);
+**/
+static GtkWidget * gnui_emblem_picker_create_supported_cell (
+	const gpointer v_self
+) {
 
-				}
+	GtkWidget * _widget_placeholder_1_, * _widget_placeholder_2_;
+	GnuiEmblemPickerEmblem * emblem_cell;
 
-				file_emblems++;
+	#define emblem_container _widget_placeholder_1_
+	#define emblem_image _widget_placeholder_2_
 
-			}
+	emblem_container = gtk_overlay_new();
 
-		}
+	emblem_image = g_object_new(
+		GTK_TYPE_IMAGE,
+		"pixel-size", GNUI_EMBLEM_PICKER_ICON_SIZE,
+		NULL
+	);
 
-		g_object_unref(finfo);
+	gtk_widget_add_css_class(emblem_image, "emblem-image");
+	gtk_overlay_set_child(GTK_OVERLAY(emblem_container), emblem_image);
 
-	}
+	emblem_cell = g_object_new(
+		GNUI_TYPE_EMBLEM_PICKER_EMBLEM,
+		"child", emblem_container,
+		NULL
+	);
 
-	#undef filellnk
-	#define namellnk _list_placeholder_1_
+	emblem_cell->face = emblem_image;
 
-	if ((namellnk = get_available_emblems(self, priv))) {
+	#undef emblem_image
+	#define indicator _widget_placeholder_2_
 
-		priv->references = namellnk;
+	indicator = g_object_new(
+		GTK_TYPE_LABEL,
+		"halign", GTK_ALIGN_START,
+		"valign", GTK_ALIGN_START,
+		NULL
+	);
 
+	g_object_bind_property(
+		v_self,
+		"reveal-changes",
+		indicator,
+		"visible",
+		G_BINDING_DEFAULT | G_BINDING_SYNC_CREATE
+	);
 
-		/* \                                  /\
-		\ */     add_supported_emblem:       /* \
-		 \/     ________________________     \ */
+	gtk_widget_add_css_class(indicator, "change-indicator");
+	emblem_cell->change_indicator = GTK_LABEL(indicator);
+	gtk_overlay_add_overlay(GTK_OVERLAY(emblem_container), indicator);
 
+	#undef indicator
+	#undef emblem_container
 
-		emref = g_new(EmblemReference, 1);
-		emref->unsupported = false;
-		emref->name = namellnk->data;
-		emref->inconsistent_group = NULL;
-		assignllnk = assignments;
+	gtk_widget_add_css_class(GTK_WIDGET(emblem_cell), "supported");
 
-		find_owned_emblem: if (assignllnk) {
+	g_signal_connect(
+		emblem_cell,
+		"clicked",
+		G_CALLBACK(gnui_emblem_picker__on_emblem_toggle),
+		v_self
+	);
 
-			owned_emblem = assignllnk->data;
+	return GTK_WIDGET(emblem_cell);
 
-			if (strcmp(namellnk->data, owned_emblem->emblem_name)) {
+}
 
-				assignllnk = assignllnk->next;
-				goto find_owned_emblem;
 
-			}
+/**
 
-			emref->inconsistent_group = owned_emblem->files;
-			g_free(owned_emblem->emblem_name);
-			g_free(owned_emblem);
-			assignments = g_list_delete_link(assignments, assignllnk);
+    gnui_emblem_picker_create_unsupported_row:
+    @emref:     (auto) (not nullable): The emblem reference to display
+    @v_self:    (auto) (not nullable): The emblem picker passed as `gpointer`
 
-		}
+    Create a row of the unsupported emblem view
 
-		if (
-			emref->inconsistent_group &&
-			g_list_length(emref->inconsistent_group) < file_amount
-		) {
+    Returns:    (transfer floating): The newly created row
 
-			emref->saved_state = emref->current_state =
-				GNUI_EMBLEM_STATE_INCONSISTENT;
+**/
+static GtkWidget * gnui_emblem_picker_create_unsupported_row (
+	GnuiEmblemPickerReference * const emref,
+	const gpointer v_self
+) {
 
-		} else {
+	GtkWidget * _widget_placeholder_1_, * _widget_placeholder_2_;
+	GnuiEmblemPickerEmblem * emblem_cell;
 
-			emref->saved_state = emref->current_state =
-				emref->inconsistent_group ?
-					GNUI_EMBLEM_STATE_SELECTED
-				:
-					GNUI_EMBLEM_STATE_NORMAL;
+	#define emblem_container _widget_placeholder_1_
+	#define emblem_label _widget_placeholder_2_
 
-			g_clear_pointer(&emref->inconsistent_group, g_list_free);
+	emblem_container = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 0);
 
-		}
+	emblem_label = g_object_new(
+		GTK_TYPE_LABEL,
+		"halign", GTK_ALIGN_START,
+		"hexpand", true,
+		NULL
+	);
 
-		gnui_emblem_picker_draw_supported_emblem(self, priv, emref);
-		namellnk->data = emref;
+	gtk_widget_add_css_class(emblem_label, "emblem-name");
+	gtk_box_prepend(GTK_BOX(emblem_container), emblem_label);
+
+	emblem_cell = g_object_new(
+		GNUI_TYPE_EMBLEM_PICKER_EMBLEM,
+		"child", emblem_container,
+		NULL
+	);
+
+	emblem_cell->face = emblem_label;
+
+	#undef emblem_label
+	#define indicator _widget_placeholder_2_
+
+	indicator = g_object_new(
+		GTK_TYPE_LABEL,
+		"halign", GTK_ALIGN_CENTER,
+		"valign", GTK_ALIGN_CENTER,
+		NULL
+	);
+
+	g_object_bind_property(
+		v_self,
+		"reveal-changes",
+		indicator,
+		"visible",
+		G_BINDING_DEFAULT | G_BINDING_SYNC_CREATE
+	);
+
+	gtk_widget_add_css_class(indicator, "change-indicator");
+	emblem_cell->change_indicator = GTK_LABEL(indicator);
+	gtk_box_append(GTK_BOX(emblem_container), indicator);
+
+	#undef indicator
+	#undef emblem_container
+
+	gtk_widget_add_css_class(GTK_WIDGET(emblem_cell), "unsupported");
+
+	g_signal_connect(
+		emblem_cell,
+		"clicked",
+		G_CALLBACK(gnui_emblem_picker__on_emblem_toggle),
+		v_self
+	);
+
+	gnui_emblem_picker_bind_cell(GTK_WIDGET(emblem_cell), emref, v_self);
+
+	/*  The cell is the only focusable and activatable widget of the row  */
+	return g_object_new(
+		GTK_TYPE_LIST_BOX_ROW,
+		"child", emblem_cell,
+		"activatable", false,
+		"focusable", false,
+		NULL
+	);
+
+}
+
+
+/**
+
+    gnui_emblem_picker_load_emblems:
+    @self:      (not nullable): The emblem picker
+    @priv:      (not nullable): The emblem picker's private `struct`
 
-		if (namellnk->next) {
+    Populate the emblem picker's emblem views with the emblems supported by
+    the theme and start reading the mapped files' emblems asynchronously
 
-			namellnk = namellnk->next;
-			goto add_supported_emblem;
+    The emblem states are filled in progressively as the files are read; the
+    emblems that are not supported by the theme are added at the end.
+
+**/
+static void gnui_emblem_picker_load_emblems (
+	GnuiEmblemPicker * const self,
+	GnuiEmblemPickerPrivate * const priv
+) {
 
-		}
+	const bool was_loading = priv->loader != NULL;
+	GnuiEmblemPickerLoader * loader;
+	GnuiEmblemPickerReference * emref;
+	const GList * filellnk;
+	gsize file_idx = 0;
 
-		if (assignments) {
+	gnui_emblem_picker_abandon_loader(priv);
+	g_clear_pointer(&priv->read_files, g_free);
 
-			namellnk->next = assignments;
-			assignments->prev = namellnk;
+	/*  Emblems supported by the theme  */
 
-		}
+	priv->references = get_available_emblems(self, priv);
+	priv->n_modified = 0;
 
-	} else {
+	for (
+		GList * namellnk = priv->references;
+			namellnk;
+		namellnk = namellnk->next
+	) {
 
-		priv->references = assignments;
+		emref = g_object_new(GNUI_TYPE_EMBLEM_PICKER_REFERENCE, NULL);
+		emref->unsupported = false;
+		emref->name = namellnk->data;
+		emref->saved_state = emref->current_state = GNUI_EMBLEM_STATE_NORMAL;
+		namellnk->data = emref;
 
 	}
 
-	#undef namellnk
-
-	assignllnk = assignments;
-
-	while (assignllnk) {
-
-		owned_emblem = assignllnk->data;
+	gnui_emblem_picker_index_references(priv);
 
-		if (
-			self->forbidden_emblems && g_strv_contains(
-				(const gchar * const *) self->forbidden_emblems,
-				owned_emblem->emblem_name
-			)
+	priv->is_single_page =
+		!self->ensure_standard ||
+		gnui_emblem_picker_add_standard_emblems(self, priv);
+
+	if (self->mapped_files) {
+
+		loader = g_new(GnuiEmblemPickerLoader, 1);
+		loader->picker = self;
+		loader->backend = g_object_ref(self->backend);
+		loader->cancellable = g_cancellable_new();
+
+		/*  Emblem quark => bitset of the indices of the files that have it  */
+		loader->assignments = g_hash_table_new_full(NULL, NULL, NULL, g_free);
+
+		loader->n_files = g_list_length(self->mapped_files);
+		loader->n_words = GNUI_BITSET_N_WORDS(loader->n_files);
+		loader->files = g_new(GFile *, loader->n_files);
+		loader->read_files = g_new0(guint64, loader->n_words);
+		loader->next_file = 0;
+		loader->n_pending = 0;
+
+		for (
+			filellnk = self->mapped_files;
+				filellnk;
+			filellnk = filellnk->next, file_idx++
 		) {
 
-			g_free(owned_emblem->emblem_name);
-			g_list_free(owned_emblem->files);
-			g_free(owned_emblem);
-			GNUI_LIST_DELETE_AND_MOVE_TO_NEXT(&assignments, &assignllnk);
-			continue;
+			loader->files[file_idx] = g_object_ref(filellnk->data);
 
 		}
 
-		emref = g_new(EmblemReference, 1);
-		emref->unsupported = true;
-		emref->name = owned_emblem->emblem_name;
-		emref->inconsistent_group = owned_emblem->files;
-
-		if (
-			g_list_length(emref->inconsistent_group) < file_amount
-		) {
+		priv->loader = loader;
 
-			emref->saved_state = emref->current_state =
-				GNUI_EMBLEM_STATE_INCONSISTENT;
-
-		} else {
+		gnui_emblem_picker_loader_dispatch(
+			loader,
+			gnui_emblem_picker__on_batch_read
+		);
 
-			emref->saved_state = emref->current_state =
-				GNUI_EMBLEM_STATE_SELECTED;
+	}
 
-			g_clear_pointer(&emref->inconsistent_group, g_list_free);
+	gnui_emblem_picker_restock_views(priv);
 
-		}
+	if (was_loading != (priv->loader != NULL)) {
 
-		gnui_emblem_picker_draw_unsupported_emblem(self, priv, emref);
-		g_free(owned_emblem);
-		assignllnk->data = emref;
-		assignllnk = assignllnk->next;
+		gnui_emblem_picker_update_loading(self, priv);
 
 	}
 
-	priv->is_single_page =
-		self->ensure_standard ?
-			!assignments &&
-			gnui_emblem_picker_add_standard_emblems(self, priv)
-		:
-			!assignments;
-
-	priv->references = g_list_sort(
-		priv->references,
-		(GCompareFunc) gnui_emblem_picker_sort_emblem_references
-	);
-
 }
 
 
@@ -1618,25 +3219,12 @@ static void gnui_emblem_picker_restart_session (
 	GnuiEmblemPickerPrivate * const priv
 ) {
 
-	const EmblemReference * emref;
-
-	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
-
-		emref = (EmblemReference *) llnk->data;
-
-		gtk_flow_box_remove(
-			GTK_FLOW_BOX(priv->pages[emref->unsupported].emblem_view),
-			emref->controller_cell
-		);
-
-		g_free(emref->name);
-		g_list_free(emref->inconsistent_group);
-
-	}
-
-	g_list_free_full(priv->references, g_free);
+	gnui_emblem_picker_abandon_saver(priv);
+	g_hash_table_remove_all(priv->reference_index);
+	g_list_free_full(priv->references, g_object_unref);
 	priv->references = NULL;
 	gnui_emblem_picker_load_emblems(self, priv);
+	gnui_emblem_picker_update_sensitivity(priv);
 	gnui_emblem_picker_repage_view(self, priv);
 
 }
@@ -1768,17 +3356,15 @@ static void gnui_emblem_picker_dispose (
 	}
 
 	g_clear_pointer(&priv->current_view, gtk_widget_unparent);
-
-	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
-
-		g_free(((EmblemReference *) llnk->data)->name);
-		g_list_free(((EmblemReference *) llnk->data)->inconsistent_group);
-
-	}
-
-	g_list_free(priv->references);
+	gnui_emblem_picker_abandon_loader(priv);
+	gnui_emblem_picker_abandon_saver(priv);
+	g_clear_pointer(&priv->read_files, g_free);
+	g_clear_pointer(&priv->reference_index, g_hash_table_unref);
+	g_list_free_full(priv->references, g_object_unref);
+	priv->references = NULL;
 	g_list_free_full(self->mapped_files, g_object_unref);
 	g_strfreev(self->forbidden_emblems);
+	g_clear_object(&self->backend);
 	G_OBJECT_CLASS(gnui_emblem_picker_parent_class)->dispose(object);
 
 }
@@ -1813,6 +3399,11 @@ static void gnui_emblem_picker_get_property (
 			g_value_set_pointer(value, self->mapped_files);
 			break;
 
+		case PROPERTY_BACKEND:
+
+			g_value_set_object(value, self->backend);
+			break;
+
 		case PROPERTY_FORBIDDEN_EMBLEMS:
 
 			/*  Transfer full  */
@@ -1839,6 +3430,11 @@ static void gnui_emblem_picker_get_property (
 			g_value_set_boolean(value, self->reveal_changes);
 			break;
 
+		case PROPERTY_LOADING:
+
+			g_value_set_boolean(value, gnui_emblem_picker_get_loading(self));
+			break;
+
 		default:
 
 			G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
@@ -1878,6 +3474,7 @@ static void gnui_emblem_picker_set_property (
 		bool b;
 		const gchar * const * a;
 		GList * l;
+		GnuiEmblemBackend * k;
 	} val;
 
 	switch (prop_id) {
@@ -1917,6 +3514,34 @@ static void gnui_emblem_picker_set_property (
 
 			break;
 
+		case PROPERTY_BACKEND:
+
+			/*  Transfer none  */
+
+			if (!(val.k = g_value_get_object(value))) {
+
+				val.k = gnui_emblem_backend_get_default();
+
+			}
+
+			if (val.k == self->backend) {
+
+				return;
+
+			}
+
+			g_set_object(&self->backend, val.k);
+
+			if (priv->current_view) {
+
+				/*  The property is being set after construction  */
+
+				gnui_emblem_picker_restart_session(self, priv);
+
+			}
+
+			break;
+
 		case PROPERTY_FORBIDDEN_EMBLEMS:
 
 			/*  Transfer none  */
@@ -1974,6 +3599,7 @@ static void gnui_emblem_picker_set_property (
 					priv->is_single_page &=
 						gnui_emblem_picker_add_standard_emblems(self, priv);
 
+					gnui_emblem_picker_restock_views(priv);
 					gnui_emblem_picker_repage_view(self, priv);
 
 				} else {
@@ -2194,6 +3820,20 @@ static void gnui_emblem_picker_class_init (
 			G_PARAM_STATIC_STRINGS
 	);
 
+	/**
+
+	    GnuiEmblemPicker:backend: (nullable) (transfer none)
+
+	**/
+	props[PROPERTY_BACKEND] = g_param_spec_object(
+		"backend",
+		"GnuiEmblemBackend *",
+		"The backend where the emblems are read from and written to",
+		GNUI_TYPE_EMBLEM_BACKEND,
+		G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY |
+			G_PARAM_STATIC_STRINGS
+	);
+
 	/**
 
 	    GnuiEmblemPicker:forbidden-emblems: (nullable) (transfer none)
@@ -2236,6 +3876,14 @@ static void gnui_emblem_picker_class_init (
 			G_PARAM_STATIC_STRINGS
 	);
 
+	props[PROPERTY_LOADING] = g_param_spec_boolean(
+		"loading",
+		"gboolean",
+		"Whether the emblems of the mapped files are still being read",
+		false,
+		G_PARAM_READABLE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
 	g_object_class_install_properties(object_class, N_PROPERTIES, props);
 
 	gtk_widget_class_set_layout_manager_type(
@@ -2334,10 +3982,13 @@ static void gnui_emblem_picker_init (
 		gnui_emblem_picker_get_instance_private(self);
 
 	GtkWidget * page_2_of_2 = gtk_box_new(GTK_ORIENTATION_VERTICAL, 6);
+	GListModel * model;
 
 	/*  `-DGNUI_EMBLEM_PICKER_BUILD_FLAG_MANUAL_ENVIRONMENT` erases this  */
 	GNUI_MODULE_ENSURE_ENVIRONMENT
 
+	priv->reference_index = g_hash_table_new(g_str_hash, g_str_equal);
+
 	priv->icon_theme = gtk_icon_theme_get_for_display(
 		gtk_widget_get_display(GTK_WIDGET(self))
 	);
@@ -2365,37 +4016,43 @@ static void gnui_emblem_picker_init (
 
 	priv->pages[PAGE_SUPPORTED].pager = ADW_LEAFLET(priv->two_pages);
 
+	priv->pages[PAGE_SUPPORTED].emblem_store =
+		g_list_store_new(GNUI_TYPE_EMBLEM_PICKER_REFERENCE);
+
+	priv->pages[PAGE_SUPPORTED].emblem_filter = GTK_FILTER(
+		gtk_custom_filter_new(
+			(GtkCustomFilterFunc) gnui_emblem_picker_filter_emblem_reference,
+			&priv->pages[PAGE_SUPPORTED],
+			NULL
+		)
+	);
+
+	/*  Only the cells in sight are instantiated (and then recycled)  */
 	priv->pages[PAGE_SUPPORTED].emblem_view = g_object_new(
-		GTK_TYPE_FLOW_BOX,
-		"selection-mode", GTK_SELECTION_NONE,
-		"activate-on-single-click", true,
-		"homogeneous", true,
+		GNUI_TYPE_FLOW,
+		"positional-classes", false,
 		"vexpand", false,
-		"focusable", true,
 		"valign", GTK_ALIGN_START,
 		NULL
 	);
 
-	gtk_flow_box_set_filter_func(
-		GTK_FLOW_BOX(priv->pages[PAGE_SUPPORTED].emblem_view),
-		gnui_emblem_picker_filter_emblem_cell,
-		&priv->pages[PAGE_SUPPORTED],
-		NULL
+	model = G_LIST_MODEL(
+		gtk_filter_list_model_new(
+			G_LIST_MODEL(priv->pages[PAGE_SUPPORTED].emblem_store),
+			priv->pages[PAGE_SUPPORTED].emblem_filter
+		)
 	);
 
-	gtk_flow_box_set_sort_func(
-		GTK_FLOW_BOX(priv->pages[PAGE_SUPPORTED].emblem_view),
-		gnui_emblem_picker_sort_emblem_cells,
-		NULL,
+	gnui_flow_bind_model(
+		GNUI_FLOW(priv->pages[PAGE_SUPPORTED].emblem_view),
+		model,
+		gnui_emblem_picker_create_supported_cell,
+		(GnuiFlowBindWidgetFunc) gnui_emblem_picker_bind_cell,
+		self,
 		NULL
 	);
 
-	g_signal_connect(
-		priv->pages[PAGE_SUPPORTED].emblem_view,
-		"child-activated",
-		G_CALLBACK(gnui_emblem_picker__on_emblem_toggle),
-		self
-	);
+	g_object_unref(model);
 
 	priv->pages[PAGE_SUPPORTED].search_entry = gtk_search_entry_new();
 
@@ -2431,38 +4088,41 @@ static void gnui_emblem_picker_init (
 
 	priv->pages[PAGE_UNSUPPORTED].pager = ADW_LEAFLET(priv->two_pages);
 
+	priv->pages[PAGE_UNSUPPORTED].emblem_store =
+		g_list_store_new(GNUI_TYPE_EMBLEM_PICKER_REFERENCE);
+
+	priv->pages[PAGE_UNSUPPORTED].emblem_filter = GTK_FILTER(
+		gtk_custom_filter_new(
+			(GtkCustomFilterFunc) gnui_emblem_picker_filter_emblem_reference,
+			&priv->pages[PAGE_UNSUPPORTED],
+			NULL
+		)
+	);
+
 	priv->pages[PAGE_UNSUPPORTED].emblem_view = g_object_new(
-		GTK_TYPE_FLOW_BOX,
+		GTK_TYPE_LIST_BOX,
 		"selection-mode", GTK_SELECTION_NONE,
-		"activate-on-single-click", true,
-		"max-children-per-line", 1,
-		"homogeneous", true,
 		"vexpand", false,
-		"focusable", true,
 		"valign", GTK_ALIGN_START,
 		NULL
 	);
 
-	gtk_flow_box_set_filter_func(
-		GTK_FLOW_BOX(priv->pages[PAGE_UNSUPPORTED].emblem_view),
-		gnui_emblem_picker_filter_emblem_cell,
-		&priv->pages[PAGE_UNSUPPORTED],
-		NULL
+	model = G_LIST_MODEL(
+		gtk_filter_list_model_new(
+			G_LIST_MODEL(priv->pages[PAGE_UNSUPPORTED].emblem_store),
+			priv->pages[PAGE_UNSUPPORTED].emblem_filter
+		)
 	);
 
-	gtk_flow_box_set_sort_func(
-		GTK_FLOW_BOX(priv->pages[PAGE_UNSUPPORTED].emblem_view),
-		gnui_emblem_picker_sort_emblem_cells,
-		NULL,
+	gtk_list_box_bind_model(
+		GTK_LIST_BOX(priv->pages[PAGE_UNSUPPORTED].emblem_view),
+		model,
+		(GtkListBoxCreateWidgetFunc) gnui_emblem_picker_create_unsupported_row,
+		self,
 		NULL
 	);
 
-	g_signal_connect(
-		priv->pages[PAGE_UNSUPPORTED].emblem_view,
-		"child-activated",
-		G_CALLBACK(gnui_emblem_picker__on_emblem_toggle),
-		self
-	);
+	g_object_unref(model);
 
 	priv->pages[PAGE_UNSUPPORTED].search_entry = gtk_search_entry_new();
 
@@ -2578,10 +4238,38 @@ static void gnui_emblem_picker_init (
 }
 
 
+/**
+
+    gnui_emblem_picker_emblem_dispose:
+    @object:    (auto) (not nullable): The emblem picker emblem passed as
+                `GObject`
+
+    Class handler for the #Object.dispose() method on the emblem picker emblem
+    instance
+
+**/
+static void gnui_emblem_picker_emblem_dispose (
+    GObject * const object
+) {
+
+	GnuiEmblemPickerEmblem * const self = GNUI_EMBLEM_PICKER_EMBLEM(object);
+
+	if (self->emref) {
+
+		self->emref->controller_cell = NULL;
+		self->emref = NULL;
+
+	}
+
+	G_OBJECT_CLASS(gnui_emblem_picker_emblem_parent_class)->dispose(object);
+
+}
+
+
 /**
 
     gnui_emblem_picker_emblem_class_init:
-    @klass:     (auto) (unused): The `GObject` klass
+    @klass:     (auto) (not nullable): The `GObject` klass
 
     The init function of the emblem picker emblem class
 
@@ -2590,6 +4278,7 @@ static void gnui_emblem_picker_emblem_class_init (
 	GnuiEmblemPickerEmblemClass * const klass
 ) {
 
+	G_OBJECT_CLASS(klass)->dispose = gnui_emblem_picker_emblem_dispose;
 	gtk_widget_class_set_css_name(GTK_WIDGET_CLASS(klass), I_("emblem"));
 
 }
@@ -2610,468 +4299,432 @@ static void gnui_emblem_picker_emblem_init (
 }
 
 
+/**
 
-/*\
-|*|
-|*| PUBLIC FUNCTIONS
-|*|
-|*| (See the public header for the documentation)
-|*|
-\*/
-
-
-void gnui_emblem_picker_refresh_states (
-	GnuiEmblemPicker * const self
-) {
-
-	g_return_if_fail(GNUI_IS_EMBLEM_PICKER(self));
-
-	const GnuiEmblemPickerPrivate * const priv =
-		gnui_emblem_picker_get_instance_private(self);
-
-	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
-
-		gnui_emblem_picker_refresh_cell(llnk->data);
-
-	}
-
-}
+    gnui_emblem_picker_reference_finalize:
+    @object:    (auto) (not nullable): The emblem reference passed as `GObject`
 
+    Class handler for the #Object.finalize() method on the emblem reference
+    instance
 
-gboolean gnui_emblem_picker_save (
-	GnuiEmblemPicker * const self,
-	const GnuiEmblemPickerForeachSavedFileFunc for_each_file,
-	const GnuiEmblemPickerSaveFlags flags,
-	GCancellable * const cancellable,
-	GError ** const error,
-	const gpointer for_each_data
+**/
+static void gnui_emblem_picker_reference_finalize (
+    GObject * const object
 ) {
 
-	typedef struct _FileEmblems {
-		GFile * location;
-		GList * current;
-		GList * saved;
-		gsize curlen;
-	} FileEmblems;
-
-	g_return_val_if_fail(GNUI_IS_EMBLEM_PICKER(self), false);
-
-	if (!self->mapped_files) {
+	GnuiEmblemPickerReference * const self =
+		GNUI_EMBLEM_PICKER_REFERENCE(object);
 
-		g_warning(
-			_(
-				"gnui_emblem_picker_save() - No files were passed to "
-				"GnuiEmblemPicker widget with address %p."
-			),
-			(gpointer) self
-		);
+	if (self->controller_cell) {
 
-		return false;
+		self->controller_cell->emref = NULL;
 
 	}
 
-	const GnuiEmblemPickerPrivate * const priv =
-		gnui_emblem_picker_get_instance_private(self);
-
-	const GList * _cllink_1_;
-	GList * tasks = NULL,  * _list_placeholder_2_, * _list_placeholder_3_;
-	FileEmblems * task;
-	EmblemReference * emref;
-	GError * saverr = NULL;
-	const gchar ** emblems_for_file, ** additions, ** removals;
-	gsize _size_1_,  _size_2_;
-	GFileAttributeType attribute_type;
-	GnuiEmblemPickerSaveResult result;
-	GnuiEmblemPickerSaveFlags fmatch;
-
-	#define filellnk _cllink_1_
+	g_free(self->name);
+	g_free(self->inconsistent_files);
+	g_list_free(self->inconsistent_group);
+	G_OBJECT_CLASS(gnui_emblem_picker_reference_parent_class)->finalize(object);
 
-	for (filellnk = self->mapped_files; filellnk; filellnk = filellnk->next) {
-
-		#define refllnk _list_placeholder_2_
-
-		refllnk = priv->references;
-		task = g_new(FileEmblems, 1);
-		task->location = filellnk->data;
-		task->current = NULL;
-		task->saved = NULL;
-		task->curlen = 0;
-
-
-		/* \                                  /\
-		\ */     process_reference:          /* \
-		 \/     ________________________     \ */
-
-
-		if (refllnk) {
-
-			#pragma GCC diagnostic push
-			#pragma GCC diagnostic ignored "-Wswitch"
-
-			emref = refllnk->data;
-
-			switch (emref->current_state) {
-
-				case GNUI_EMBLEM_STATE_INCONSISTENT:
-
-					#define inconsllnk _list_placeholder_3_
-
-					inconsllnk = emref->inconsistent_group;
-
-
-					/* \                                  /\
-					\ */     is_in_inconsistency:        /* \
-					 \/     ________________________     \ */
-
-
-					if (!inconsllnk) {
-
-						break;
-
-					}
-
-					if (inconsllnk->data != filellnk->data) {
-
-						inconsllnk = inconsllnk->next;
-						goto is_in_inconsistency;
-
-					}
+}
 
-					#undef inconsllnk
 
-				/*  fallthrough  */
+/**
 
-				case GNUI_EMBLEM_STATE_SELECTED:
+    gnui_emblem_picker_reference_class_init:
+    @klass:     (auto) (not nullable): The `GObject` klass
 
-					task->current = g_list_prepend(task->current, emref);
-					task->curlen++;
+    The init function of the emblem reference class
 
-			}
+**/
+static void gnui_emblem_picker_reference_class_init (
+	GnuiEmblemPickerReferenceClass * const klass
+) {
 
-			switch (emref->saved_state) {
+	G_OBJECT_CLASS(klass)->finalize = gnui_emblem_picker_reference_finalize;
 
-				case GNUI_EMBLEM_STATE_INCONSISTENT:
+}
 
-					#define inconsllnk _list_placeholder_3_
 
-					inconsllnk = emref->inconsistent_group;
+/**
 
+    gnui_emblem_picker_reference_init:
+    @self:  (auto) (unused): The newly allocated emblem reference
 
-					/* \                                  /\
-					\ */     was_in_inconsistency:       /* \
-					 \/     ________________________     \ */
+    The init function of the emblem reference instance
 
+**/
+static void gnui_emblem_picker_reference_init (
+	GnuiEmblemPickerReference * const self G_GNUC_UNUSED
+) {
 
-					if (!inconsllnk) {
+}
 
-						break;
 
-					}
 
-					if (inconsllnk->data != filellnk->data) {
+/*\
+|*|
+|*| PUBLIC FUNCTIONS
+|*|
+|*| (See the public header for the documentation)
+|*|
+\*/
 
-						inconsllnk = inconsllnk->next;
-						goto was_in_inconsistency;
 
-					}
+void gnui_emblem_picker_refresh_states (
+	GnuiEmblemPicker * const self
+) {
 
-					#undef inconsllnk
+	g_return_if_fail(GNUI_IS_EMBLEM_PICKER(self));
 
-				/*  fallthrough  */
+	const GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(self);
 
-				case GNUI_EMBLEM_STATE_SELECTED:
+	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
 
-					task->saved = g_list_prepend(task->saved, emref);
+		gnui_emblem_picker_refresh_cell(llnk->data);
 
-			}
+	}
 
-			#pragma GCC diagnostic pop
+}
 
-			refllnk = refllnk->next;
-			goto process_reference;
 
-		}
+gboolean gnui_emblem_picker_save (
+	GnuiEmblemPicker * const self,
+	const GnuiEmblemPickerForeachSavedFileFunc for_each_file,
+	const GnuiEmblemPickerSaveFlags flags,
+	GCancellable * const cancellable,
+	GError ** const error,
+	const gpointer for_each_data
+) {
 
-		#undef refllnk
+	g_return_val_if_fail(GNUI_IS_EMBLEM_PICKER(self), false);
 
-		tasks = g_list_prepend(tasks, task);
+	if (!self->mapped_files) {
 
-	}
+		g_warning(
+			_(
+				"gnui_emblem_picker_save() - No files were passed to "
+				"GnuiEmblemPicker widget with address %p."
+			),
+			(gpointer) self
+		);
 
-	#undef filellnk
-	#define taskllnk _cllink_1_
+		return false;
 
-	for (taskllnk = tasks; taskllnk; taskllnk = taskllnk->next) {
+	}
 
-		task = taskllnk->data;
+	GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(self);
 
-		if (task->current) {
+	if (priv->loader || priv->saver) {
 
-			#define alllen _size_1_
-			#define idx _size_2_
-			#define crefllnk _list_placeholder_2_
+		g_warning(
+			_(
+				"gnui_emblem_picker_save() - GnuiEmblemPicker widget with "
+				"address %p is still loading or saving the emblems of its "
+				"files."
+			),
+			(gpointer) self
+		);
 
-			alllen = task->curlen; 
-			attribute_type = G_FILE_ATTRIBUTE_TYPE_STRINGV;
-			emblems_for_file = g_new(const gchar *, alllen + 1);
+		return false;
 
-			for (
-				idx = 0, crefllnk = task->current;
-					crefllnk && idx < alllen;
-				emblems_for_file[idx++] =
-					((EmblemReference *) crefllnk->data)->name,
-				crefllnk = crefllnk->next
-			);
+	}
 
-			emblems_for_file[idx] = NULL;
+	gsize n_jobs;
+	GnuiEmblemPickerSaveJob * const jobs =
+		gnui_emblem_picker_plan_save(self, priv, flags, &n_jobs);
 
-			#undef crefllnk
-			#undef idx
-			#undef alllen
+	/*  In abort mode no file is written after the first failure  */
+	const gsize batch_size =
+		flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_ABORT_MODE ?
+			1
+		:
+			GNUI_EMBLEM_PICKER_BATCH_SIZE;
 
-		} else {
+	GFile ** const locations = g_new(GFile *, batch_size);
+	const gchar * const ** const emblems =
+		g_new(const gchar * const *, batch_size);
+	GError ** const errors = g_new0(GError *, batch_size);
+	GnuiEmblemPickerSaveJob * job = jobs, * window_end;
+	GnuiEmblemPickerSaveResult result;
+	GnuiEmblemPickerSaveFlags fmatch;
+	gsize n_batch, batch_idx;
 
-			attribute_type = G_FILE_ATTRIBUTE_TYPE_INVALID;
-			emblems_for_file = NULL;
+	while (job < jobs + n_jobs) {
 
-		}
+		/*  Gather the next batch of writes  */
 
-		#define crefllnk _list_placeholder_2_
-		#define orefllnk _list_placeholder_3_
-		#define newlen _size_1_
+		for (
+			window_end = job, n_batch = 0;
+				window_end < jobs + n_jobs && n_batch < batch_size;
+			window_end++
+		) {
 
-		crefllnk = task->current;
-		newlen = 0;
+			if (gnui_emblem_picker_save_job_needs_write(window_end, flags)) {
 
+				locations[n_batch] = window_end->location;
+				emblems[n_batch++] = window_end->emblems;
 
-		/* \                                  /\
-		\ */     process_current:            /* \
-		 \/     ________________________     \ */
+			}
 
+		}
 
-		if (crefllnk) {
+		if (n_batch) {
 
-			orefllnk = task->saved;
+			gnui_emblem_backend_write_batch(
+				self->backend,
+				locations,
+				emblems,
+				n_batch,
+				errors,
+				cancellable
+			);
 
+		}
 
-			/* \                                  /\
-			\ */     process_saved:              /* \
-			 \/     ________________________     \ */
+		/*  Report the files of the batch in order  */
 
+		for (batch_idx = 0; job < window_end; job++) {
 
-			if (orefllnk) {
+			if (gnui_emblem_picker_save_job_needs_write(job, flags)) {
 
-				if (crefllnk->data == orefllnk->data) {
+				if (errors[batch_idx]) {
 
-					task->saved = g_list_delete_link(task->saved, orefllnk);
+					result = GNUI_EMBLEM_PICKER_ERROR;
+					fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_ERROR;
 
-					GNUI_LIST_DELETE_AND_MOVE_TO_NEXT(
-						&task->current,
-						&crefllnk
-					);
+				} else {
 
-					goto process_current;
+					result = GNUI_EMBLEM_PICKER_SUCCESS;
+					fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_SUCCESS;
 
 				}
 
-				orefllnk = orefllnk->next;
-				goto process_saved;
+				batch_idx++;
 
-			}
+			} else {
 
-			newlen++;
-			crefllnk = crefllnk->next;
-			goto process_current;
+				result = GNUI_EMBLEM_PICKER_NOACTION;
+				fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_NOACTION;
 
-		}
+			}
 
-		#undef orefllnk
-		#undef crefllnk
+			if (
+				(
+					for_each_file &&
+					(flags & fmatch) &&
+					!for_each_file(
+						job->location,
+						job->additions,
+						job->removals,
+						result,
+						result == GNUI_EMBLEM_PICKER_ERROR ?
+							errors[batch_idx - 1]
+						:
+							NULL,
+						for_each_data
+					)
+				) || (
+					result == GNUI_EMBLEM_PICKER_ERROR &&
+					(flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_ABORT_MODE)
+				)
+			) {
 
-		if (newlen > 0) {
+				if (result == GNUI_EMBLEM_PICKER_ERROR) {
 
-			#define idx _size_2_
-			#define crefllnk _list_placeholder_2_
+					g_propagate_error(
+						error,
+						g_steal_pointer(errors + batch_idx - 1)
+					);
 
-			additions = g_new(const gchar *, newlen + 1);
+				}
 
-			for (
-				idx = 0, crefllnk = task->current;
-					crefllnk && idx < newlen;
-				additions[idx++] = ((EmblemReference *) crefllnk->data)->name,
-				crefllnk = crefllnk->next
-			);
+				for (batch_idx = 0; batch_idx < n_batch; batch_idx++) {
 
-			additions[idx] = NULL;
+					g_clear_error(errors + batch_idx);
 
-			#undef crefllnk
-			#undef idx
+				}
 
-		} else {
+				g_free(errors);
+				g_free(emblems);
+				g_free(locations);
+				gnui_emblem_picker_free_save_jobs(jobs, n_jobs);
+				return false;
 
-			additions = NULL;
+			}
 
 		}
 
-		#undef newlen
-		#define oldlen _size_1_
+		for (batch_idx = 0; batch_idx < n_batch; batch_idx++) {
 
-		oldlen = g_list_length(task->saved);
+			g_clear_error(errors + batch_idx);
 
-		if (oldlen > 0) {
+		}
 
-			#define idx _size_2_
-			#define orefllnk _list_placeholder_2_
+	}
 
-			removals = g_new(const gchar *, oldlen + 1);
+	g_free(errors);
+	g_free(emblems);
+	g_free(locations);
+	gnui_emblem_picker_free_save_jobs(jobs, n_jobs);
+	gnui_emblem_picker_commit_saved_states(self, priv, flags);
+	return true;
 
-			for (
-				idx = 0, orefllnk = task->saved;
-					orefllnk && idx < oldlen;
-				removals[idx++] = ((EmblemReference *) orefllnk->data)->name,
-				orefllnk = orefllnk->next
-			);
+}
 
-			removals[idx] = NULL;
 
-			#undef orefllnk
-			#undef idx
+void gnui_emblem_picker_save_async (
+	GnuiEmblemPicker * const self,
+	const GnuiEmblemPickerForeachSavedFileFunc for_each_file,
+	const gpointer for_each_data,
+	const GnuiEmblemPickerSaveFlags flags,
+	GCancellable * const cancellable,
+	const GAsyncReadyCallback callback,
+	const gpointer user_data
+) {
 
-		} else {
+	g_return_if_fail(GNUI_IS_EMBLEM_PICKER(self));
 
-			removals = NULL;
+	GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(self);
 
-		}
+	if (!self->mapped_files) {
 
-		#undef oldlen
+		g_task_report_new_error(
+			self,
+			callback,
+			user_data,
+			gnui_emblem_picker_save_async,
+			G_IO_ERROR,
+			G_IO_ERROR_INVALID_ARGUMENT,
+			_("No files were passed to the emblem picker")
+		);
 
-		if (
-			additions ||
-			removals ||
-			(flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_SAVE_UNMODIFIED)
-		) {
+		return;
 
-			if (
-				g_file_set_attribute(
-					task->location,
-					G_FILE_ATTRIBUTE_METADATA_EMBLEMS,
-					attribute_type,
-					emblems_for_file,
-					G_FILE_QUERY_INFO_NONE,
-					cancellable,
-					&saverr
-				)
-			) {
+	}
 
-				result = GNUI_EMBLEM_PICKER_SUCCESS;
-				fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_SUCCESS;
+	if (priv->loader || priv->saver) {
 
-			} else {
+		g_task_report_new_error(
+			self,
+			callback,
+			user_data,
+			gnui_emblem_picker_save_async,
+			G_IO_ERROR,
+			G_IO_ERROR_PENDING,
+			_("The emblem picker is still loading or saving")
+		);
 
-				result = GNUI_EMBLEM_PICKER_ERROR;
-				fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_ERROR;
+		return;
 
-			}
+	}
 
-		} else {
+	GnuiEmblemPickerSaver * const saver = g_new(GnuiEmblemPickerSaver, 1);
 
-			result = GNUI_EMBLEM_PICKER_NOACTION;
-			fmatch = GNUI_EMBLEM_PICKER_SAVE_FLAG_CALLBACK_ON_NOACTION;
+	saver->picker = self;
+	saver->backend = g_object_ref(self->backend);
+	saver->task = g_task_new(self, cancellable, callback, user_data);
+	saver->cancellable = g_cancellable_new();
+	saver->user_cancellable = cancellable;
+	saver->jobs = gnui_emblem_picker_plan_save(
+		self,
+		priv,
+		flags,
+		&saver->n_jobs
+	);
 
-		}
+	saver->for_each_file = for_each_file;
+	saver->for_each_data = for_each_data;
+	saver->error = NULL;
+	saver->next_job = 0;
+	saver->n_pending = 0;
+	saver->n_saved = 0;
+	saver->n_failed = 0;
+	saver->n_unchanged = 0;
+	saver->flags = flags;
+	saver->aborted = false;
 
-		g_free(emblems_for_file);
+	/*  The jobs borrow the emblem names from the references  */
+	saver->references = g_list_copy(priv->references);
 
-		if (
-			(
-				for_each_file &&
-				(flags & fmatch) &&
-				!for_each_file(
-					task->location,
-					additions,
-					removals,
-					result,
-					saverr,
-					for_each_data
-				)
-			) || (
-				result == GNUI_EMBLEM_PICKER_ERROR &&
-				(flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_ABORT_MODE)
-			)
-		) {
+	for (const GList * llnk = saver->references; llnk; llnk = llnk->next) {
 
-			while (taskllnk) {
+		g_object_ref(llnk->data);
 
-				g_list_free(((FileEmblems *) taskllnk->data)->saved);
-				g_list_free(((FileEmblems *) taskllnk->data)->current);
-				g_free(taskllnk->data);
-				taskllnk = taskllnk->next;
+	}
 
-			}
+	for (gsize idx = 0; idx < saver->n_jobs; idx++) {
 
-			g_free(additions);
-			g_free(removals);
-			g_list_free(tasks);
-			g_propagate_error(error, saverr);
-			return false;
+		saver->jobs[idx].saver = saver;
 
-		}
+	}
 
-		g_clear_error(&saverr);
-		g_list_free(task->saved);
-		g_list_free(task->current);
-		g_free(additions);
-		g_free(removals);
+	g_task_set_source_tag(saver->task, gnui_emblem_picker_save_async);
 
-	}
+	g_task_set_task_data(
+		saver->task,
+		saver,
+		gnui_emblem_picker_saver_free
+	);
 
-	g_list_free_full(tasks, g_free);
+	saver->cancel_handler = cancellable ?
+		g_cancellable_connect(
+			cancellable,
+			G_CALLBACK(gnui_emblem_picker__on_save_cancelled),
+			saver->cancellable,
+			NULL
+		)
+	:
+		0;
 
-	#undef taskllnk
-	#define refllnk _cllink_1_
+	priv->saver = saver;
+	gnui_emblem_picker_update_sensitivity(priv);
 
-	if (flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_CLEAN_INCONSISTENCY) {
+	gnui_emblem_picker_saver_dispatch(
+		saver,
+		gnui_emblem_picker__on_batch_written
+	);
 
-		for (refllnk = priv->references; refllnk; refllnk = refllnk->next) {
+}
 
-			emref = refllnk->data;
-			emref->saved_state = emref->current_state;
-			g_clear_pointer(&emref->inconsistent_group, g_list_free);
 
-		}
+gboolean gnui_emblem_picker_save_finish (
+	GnuiEmblemPicker * const self,
+	GAsyncResult * const result,
+	gsize * const n_saved,
+	gsize * const n_failed,
+	gsize * const n_unchanged,
+	GError ** const error
+) {
 
-	} else {
+	g_return_val_if_fail(GNUI_IS_EMBLEM_PICKER(self), false);
+	g_return_val_if_fail(g_task_is_valid(result, self), false);
 
-		for (refllnk = priv->references; refllnk; refllnk = refllnk->next) {
+	const GnuiEmblemPickerSaver * const saver =
+		g_task_get_task_data(G_TASK(result));
 
-			((EmblemReference *) refllnk->data)->saved_state =
-				((EmblemReference *) refllnk->data)->current_state;
+	if (n_saved) {
 
-		}
+		*n_saved = saver ? saver->n_saved : 0;
 
 	}
 
-	if (self->modified) {
+	if (n_failed) {
 
-		self->modified = false;
-		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_MODIFIED]);
-		g_signal_emit(self, signals[SIGNAL_MODIFIED_CHANGED], 0, false);
+		*n_failed = saver ? saver->n_failed : 0;
 
 	}
 
-	if (~flags & GNUI_EMBLEM_PICKER_SAVE_FLAG_DONT_REFRESH) {
-
-		for (refllnk = priv->references; refllnk; refllnk = refllnk->next) {
-
-			gnui_emblem_picker_refresh_cell(refllnk->data);
+	if (n_unchanged) {
 
-		}
+		*n_unchanged = saver ? saver->n_unchanged : 0;
 
 	}
 
-	#undef refllnk
-
-	return true;
+	return g_task_propagate_boolean(G_TASK(result), error);
 
 }
 
@@ -3087,22 +4740,20 @@ gboolean gnui_emblem_picker_toggle_emblem (
 	const GnuiEmblemPickerPrivate * const priv =
 		gnui_emblem_picker_get_instance_private(self);
 
-	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
-
-		#define emref ((EmblemReference * ) llnk->data)
-
-		if (!strcmp(emref->name, emblem_name)) {
-
-			gnui_emblem_picker_toggle_emblem_reference(self, emref);
-			return true;
+	GnuiEmblemPickerReference * emref;
 
-		}
+	if (
+		priv->loader ||
+		priv->saver ||
+		!(emref = g_hash_table_lookup(priv->reference_index, emblem_name))
+	) {
 
-		#undef emref
+		return false;
 
 	}
 
-	return false;
+	gnui_emblem_picker_toggle_emblem_reference(self, emref);
+	return true;
 
 }
 
@@ -3120,86 +4771,63 @@ gboolean gnui_emblem_picker_set_emblem_state (
 	GnuiEmblemPickerPrivate * const priv =
 		gnui_emblem_picker_get_instance_private(self);
 
-	EmblemReference * emref;
-
-	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
-
-		emref = llnk->data;
-
-		if (!strcmp(emref->name, emblem_name)) {
-
-			if (
-				state == GNUI_EMBLEM_STATE_INCONSISTENT &&
-				!emref->inconsistent_group
-			) {
-
-				return false;
-
-			}
-
-			emref->current_state = state;
-			gnui_emblem_picker_refresh_cell(emref);
-			goto change_modif_and_exit;
-
-		}
-
-	}
-
-	if (!add_if_missing) {
+	if (
+		priv->loader ||
+		priv->saver ||
+		!gnui_emblem_picker_apply_emblem_state(
+			self,
+			priv,
+			emblem_name,
+			state,
+			add_if_missing
+		)
+	) {
 
 		return false;
 
 	}
 
-	if (self->forbidden_emblems) {
-
-		const gchar * const * nameptr =
-			(const gchar * const * ) self->forbidden_emblems - 1;
-
-		while (*++nameptr) {
+	gnui_emblem_picker_update_modified(self, priv);
+	return true;
 
-			if (!strcmp(emblem_name, *nameptr)) {
+}
 
-				return false;
 
-			}
+guint gnui_emblem_picker_set_emblem_states (
+	GnuiEmblemPicker * const self,
+	const gchar * const * const emblem_names,
+	const GnuiEmblemState state,
+	const gboolean add_if_missing
+) {
 
-		}
+	g_return_val_if_fail(GNUI_IS_EMBLEM_PICKER(self), 0);
+	g_return_val_if_fail(emblem_names != NULL, 0);
 
-	}
+	GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(self);
 
-	emref = g_new(EmblemReference, 1);
-	emref->name = g_strdup(emblem_name);
-	emref->inconsistent_group = NULL;
-	emref->saved_state = GNUI_EMBLEM_STATE_NORMAL;
-	emref->current_state = state;
-	emref->unsupported = true;
-	priv->references = g_list_prepend(priv->references, emref);
-	gnui_emblem_picker_draw_unsupported_emblem(self, priv, emref);
-	gnui_emblem_picker_refresh_cell(emref);
+	guint n_set = 0;
 
-	if (priv->is_single_page) {
+	if (priv->loader || priv->saver) {
 
-		priv->is_single_page = false;
-		gnui_emblem_picker_repage_view(self, priv);
+		return 0;
 
 	}
 
+	for (const gchar * const * nameptr = emblem_names; *nameptr; nameptr++) {
 
-	/* \                                  /\
-	\ */     change_modif_and_exit:      /* \
-	 \/     ________________________     \ */
-
-
-	if (!self->modified) {
-
-		self->modified = true;
-		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_MODIFIED]);
-		g_signal_emit(self, signals[SIGNAL_MODIFIED_CHANGED], 0, true);
+		n_set += gnui_emblem_picker_apply_emblem_state(
+			self,
+			priv,
+			*nameptr,
+			state,
+			add_if_missing
+		);
 
 	}
 
-	return true;
+	gnui_emblem_picker_update_modified(self, priv);
+	return n_set;
 
 }
 
@@ -3216,7 +4844,7 @@ void gnui_emblem_picker_foreach (
 	const GnuiEmblemPickerPrivate * const priv =
 		gnui_emblem_picker_get_instance_private(self);
 
-	const EmblemReference * emref;
+	GnuiEmblemPickerReference * emref;
 
 	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
 
@@ -3228,7 +4856,7 @@ void gnui_emblem_picker_foreach (
 				emref->name,
 				emref->saved_state,
 				emref->current_state,
-				emref->inconsistent_group,
+				gnui_emblem_picker_peek_inconsistent_group(self, emref),
 				user_data
 			)
 		) {
@@ -3248,10 +4876,16 @@ void gnui_emblem_picker_undo_all_selections (
 
 	g_return_if_fail(GNUI_IS_EMBLEM_PICKER(self));
 
-	const GnuiEmblemPickerPrivate * const priv =
+	GnuiEmblemPickerPrivate * const priv =
 		gnui_emblem_picker_get_instance_private(self);
 
-	EmblemReference * emref;
+	GnuiEmblemPickerReference * emref;
+
+	if (priv->loader || priv->saver) {
+
+		return;
+
+	}
 
 	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
 
@@ -3261,6 +4895,9 @@ void gnui_emblem_picker_undo_all_selections (
 
 	}
 
+	priv->n_modified = 0;
+	gnui_emblem_picker_update_modified(self, priv);
+
 }
 
 
@@ -3271,7 +4908,7 @@ void gnui_emblem_picker_set_all_selections (
 
 	g_return_if_fail(GNUI_IS_EMBLEM_PICKER(self));
 
-	const GnuiEmblemPickerPrivate * const priv =
+	GnuiEmblemPickerPrivate * const priv =
 		gnui_emblem_picker_get_instance_private(self);
 
 	const GnuiEmblemState state =
@@ -3280,13 +4917,21 @@ void gnui_emblem_picker_set_all_selections (
 		:
 			GNUI_EMBLEM_STATE_NORMAL;
 
+	if (priv->loader || priv->saver) {
+
+		return;
+
+	}
+
 	for (const GList * llnk = priv->references; llnk; llnk = llnk->next) {
 
-		((EmblemReference *) llnk->data)->current_state = state;
+		gnui_emblem_picker_reference_change_state(priv, llnk->data, state);
 		gnui_emblem_picker_refresh_cell(llnk->data);
 
 	}
 
+	gnui_emblem_picker_update_modified(self, priv);
+
 }
 
 
@@ -3356,6 +5001,46 @@ void gnui_emblem_picker_set_mapped_files (
 }
 
 
+GnuiEmblemBackend * gnui_emblem_picker_get_backend (
+	GnuiEmblemPicker * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_EMBLEM_PICKER(self), NULL);
+
+	return self->backend;
+
+}
+
+
+void gnui_emblem_picker_set_backend (
+	GnuiEmblemPicker * const self,
+	GnuiEmblemBackend * const backend
+) {
+
+	g_return_if_fail(GNUI_IS_EMBLEM_PICKER(self));
+	g_return_if_fail(!backend || GNUI_IS_EMBLEM_BACKEND(backend));
+
+	GnuiEmblemBackend * const new_backend =
+		backend ? backend : gnui_emblem_backend_get_default();
+
+	if (new_backend == self->backend) {
+
+		return;
+
+	}
+
+	g_set_object(&self->backend, new_backend);
+
+	gnui_emblem_picker_restart_session(
+		self,
+		gnui_emblem_picker_get_instance_private(self)
+	);
+
+	g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_BACKEND]);
+
+}
+
+
 const gchar * const * gnui_emblem_picker_peek_forbidden_emblems (
 	GnuiEmblemPicker * const self
 ) {
@@ -3450,6 +5135,7 @@ void gnui_emblem_picker_set_ensure_standard (
 				priv
 			);
 
+			gnui_emblem_picker_restock_views(priv);
 			gnui_emblem_picker_repage_view(self, priv);
 
 		} else {
@@ -3532,6 +5218,34 @@ void gnui_emblem_picker_set_reveal_changes (
 }
 
 
+gboolean gnui_emblem_picker_get_loading (
+	GnuiEmblemPicker * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_EMBLEM_PICKER(self), false);
+
+	const GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(self);
+
+	return priv->loader != NULL;
+
+}
+
+
+GCancellable * gnui_emblem_picker_get_loading_cancellable (
+	GnuiEmblemPicker * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_EMBLEM_PICKER(self), NULL);
+
+	const GnuiEmblemPickerPrivate * const priv =
+		gnui_emblem_picker_get_instance_private(self);
+
+	return priv->loader ? priv->loader->cancellable : NULL;
+
+}
+
+
 G_GNUC_WARN_UNUSED_RESULT GtkWidget * gnui_emblem_picker_new (
 	GList * const mapped_files,
 	const gboolean ensure_standard,
@@ -30,6 +30,7 @@
 
 
 #include <gtk/gtk.h>
+#include "gnui-emblem-backend.h"
 
 
 G_BEGIN_DECLS
@@ -288,6 +289,17 @@ extern GtkWidget * gnui_emblem_picker_new (
 
     Save the emblems currently selected into the files' metadata
 
+    The files are handed to the emblem backend (see
+    `gnui_emblem_picker_set_backend()`) in batches, one file at a time in
+    abort mode. If @for_each_file returns `false`, the other files of the same
+    batch might have been written already.
+
+    Nothing is saved while the emblem picker is still loading (see
+    `gnui_emblem_picker_get_loading()`) or while an asynchronous save is in
+    progress. If the last loading session was cancelled or could not read
+    some files, those files are left untouched, since their emblems are
+    unknown.
+
     Returns:    `true` if all the emblems were successfully saved, `false`
                 otherwise
 
@@ -302,6 +314,80 @@ extern gboolean gnui_emblem_picker_save (
 );
 
 
+/**
+
+    gnui_emblem_picker_save_async:
+    @self:          (not nullable): The emblem picker
+    @for_each_file: (nullable): A function to call for each saved file
+                    according to the conditions expressed by the @flag
+                    parameter
+    @for_each_data: (nullable): The custom data to pass to @for_each_file
+    @flags:         Save options flags
+    @cancellable:   (nullable): A `GCancellable`
+    @callback:      (scope async) (nullable): The function to call when the
+                    save is over
+    @user_data:     (closure): The custom data to pass to @callback
+
+    Save the emblems currently selected into the files' metadata without
+    blocking
+
+    The files are handed to the emblem backend in batches, from worker
+    threads; only a limited number of batches are written at the same time.
+    @for_each_file is invoked in the thread-default main context of the
+    caller as soon as each file is done, in no particular order. If
+    @for_each_file returns `false`, or if a file cannot be saved and
+    `GNUI_EMBLEM_PICKER_SAVE_FLAG_ABORT_MODE` is present in @flags, the
+    writes still in flight are cancelled and no more files are reported.
+
+    The emblem views are insensitive until the save is over. Call
+    `gnui_emblem_picker_save_finish()` from @callback to get the result. As
+    with `gnui_emblem_picker_save()`, the files whose emblems could not be
+    read are left untouched.
+
+**/
+extern void gnui_emblem_picker_save_async (
+    GnuiEmblemPicker * const self,
+    const GnuiEmblemPickerForeachSavedFileFunc for_each_file,
+    const gpointer for_each_data,
+    const GnuiEmblemPickerSaveFlags flags,
+    GCancellable * const cancellable,
+    const GAsyncReadyCallback callback,
+    const gpointer user_data
+);
+
+
+/**
+
+    gnui_emblem_picker_save_finish:
+    @self:          (not nullable): The emblem picker
+    @result:        (not nullable): The `GAsyncResult` passed to the callback
+                    of `gnui_emblem_picker_save_async()`
+    @n_saved:       (out) (optional): The number of files that were written
+    @n_failed:      (out) (optional): The number of files that could not be
+                    written
+    @n_unchanged:   (out) (optional): The number of files that did not need
+                    to be written
+    @error:         (nullable): A `GError` or `NULL`
+
+    Conclude a save started with `gnui_emblem_picker_save_async()`
+
+    The emblem picker's saved states are updated only when the save is
+    carried out till the end.
+
+    Returns:    `true` if the save was carried out till the end, `false` if
+                it was aborted or cancelled (or could not start)
+
+**/
+extern gboolean gnui_emblem_picker_save_finish (
+    GnuiEmblemPicker * const self,
+    GAsyncResult * const result,
+    gsize * const n_saved,
+    gsize * const n_failed,
+    gsize * const n_unchanged,
+    GError ** const error
+);
+
+
 /**
 
     gnui_emblem_picker_refresh_states:
@@ -331,6 +417,9 @@ extern void gnui_emblem_picker_refresh_states (
     This function behaves exactly like toggling/untoggling an emblem via user
     input.
 
+    Returns:    `true` if the emblem was found, `false` if it was not found or
+                if the emblem picker is still loading or saving
+
 **/
 extern gboolean gnui_emblem_picker_toggle_emblem (
     GnuiEmblemPicker * const self,
@@ -353,6 +442,11 @@ extern gboolean gnui_emblem_picker_toggle_emblem (
     When @add_if_missing is set to false this function behaves exactly like
     toggling/untoggling an emblem via user input.
 
+    Returns:    `true` if the emblem state was set, `false` if the emblem was
+                not found (and @add_if_missing is `false`), if the state
+                requested is not allowed or if the emblem picker is still
+                loading or saving
+
 **/
 extern gboolean gnui_emblem_picker_set_emblem_state (
     GnuiEmblemPicker * const self,
@@ -362,6 +456,34 @@ extern gboolean gnui_emblem_picker_set_emblem_state (
 );
 
 
+/**
+
+    gnui_emblem_picker_set_emblem_states:
+    @self:              (not nullable): The emblem picker
+    @emblem_names:      (transfer none) (not nullable): A `NULL`-terminated
+                        array containing the names of the emblems to set
+    @state:             The state to assign to the emblems
+    @add_if_missing:    If `true`, create the emblems that are not found
+
+    Set the state of many emblems of an emblem picker at once
+
+    This function behaves like calling `gnui_emblem_picker_set_emblem_state()`
+    for each emblem in @emblem_names, but the
+    #GnuiEmblemPicker::modified-changed signal is emitted (at most) once,
+    after all the emblems have been set.
+
+    Returns:    The number of emblems whose state was set (zero if the emblem
+                picker is still loading or saving)
+
+**/
+extern guint gnui_emblem_picker_set_emblem_states (
+    GnuiEmblemPicker * const self,
+    const gchar * const * const emblem_names,
+    const GnuiEmblemState state,
+    const gboolean add_if_missing
+);
+
+
 /**
 
     gnui_emblem_picker_peek_mapped_files: (get-property mapped-files)
@@ -415,6 +537,40 @@ extern void gnui_emblem_picker_set_mapped_files (
 );
 
 
+/**
+
+    gnui_emblem_picker_get_backend: (get-property backend)
+    @self:      (not nullable): The emblem picker
+
+    Get the backend where an emblem picker reads and writes the emblems
+
+    Returns:    (transfer none): The emblem backend
+
+**/
+extern GnuiEmblemBackend * gnui_emblem_picker_get_backend (
+    GnuiEmblemPicker * const self
+);
+
+
+/**
+
+    gnui_emblem_picker_set_backend: (set-property backend)
+    @self:      (not nullable): The emblem picker
+    @backend:   (transfer none) (nullable): The emblem backend to use, or
+                `NULL` for the default one
+
+    Set the backend where an emblem picker reads and writes the emblems
+
+    As with `gnui_emblem_picker_set_mapped_files()`, changing the backend
+    starts a new session and the current emblem selection will be lost.
+
+**/
+extern void gnui_emblem_picker_set_backend (
+    GnuiEmblemPicker * const self,
+    GnuiEmblemBackend * const backend
+);
+
+
 /**
 
     gnui_emblem_picker_peek_forbidden_emblems: (get-property forbidden-emblems)
@@ -599,6 +755,11 @@ extern void gnui_emblem_picker_foreach (
 
     Bring an emblem picker selection state back to the last saved state
 
+    The #GnuiEmblemPicker:modified property is reset to `false`.
+
+    This function does nothing while the emblem picker is still loading or
+    saving.
+
 **/
 extern void gnui_emblem_picker_undo_all_selections (
     GnuiEmblemPicker * const self
@@ -614,6 +775,9 @@ extern void gnui_emblem_picker_undo_all_selections (
 
     Set the selection state of all the emblems of an emblem picker
 
+    This function does nothing while the emblem picker is still loading or
+    saving.
+
 **/
 extern void gnui_emblem_picker_set_all_selections (
     GnuiEmblemPicker * const self,
@@ -622,6 +786,51 @@ extern void gnui_emblem_picker_set_all_selections (
 
 
 
+/**
+
+    gnui_emblem_picker_get_loading: (get-property loading)
+    @self:      (not nullable): The emblem picker
+
+    Get whether the emblem picker is still reading the emblems of its files
+
+    The emblems of the mapped files are read asynchronously and the emblem
+    states are filled in as the files are read: until the loading is over the
+    emblem views are insensitive, no emblem is displayed as selected (only as
+    inconsistent) and the emblems that are not supported by the icon theme
+    are not displayed.
+
+    Returns:    `true` if the emblem picker is still loading, `false`
+                otherwise
+
+**/
+extern gboolean gnui_emblem_picker_get_loading (
+    GnuiEmblemPicker * const self
+);
+
+
+/**
+
+    gnui_emblem_picker_get_loading_cancellable:
+    @self:      (not nullable): The emblem picker
+
+    Get the `GCancellable` of the loading session in progress
+
+    Cancelling it stops reading the files: the emblem states are then
+    computed from the files read so far, as if the remaining ones could not
+    be read. A new `GCancellable` is created every time the mapped files
+    change.
+
+    Returns:    (transfer none) (nullable): The `GCancellable` of the loading
+                session in progress, or `NULL` if the emblem picker is not
+                loading
+
+**/
+extern GCancellable * gnui_emblem_picker_get_loading_cancellable (
+    GnuiEmblemPicker * const self
+);
+
+
+
 /*  Signal handler types  */
 
 
@@ -96,6 +96,49 @@ G_BEGIN_DECLS
 #define GNUI_TYPE_FLOW_CHILD_LAYOUT (gnui_flow_child_layout_get_type())
 
 
+/**
+
+    GnuiFlowPacking:
+    @GNUI_FLOW_PACKING_GREEDY:  Fill each row before starting the next one;
+                                every row is as thick as its thickest child
+    @GNUI_FLOW_PACKING_MASONRY: Place each child in the currently shortest of
+                                a series of lanes as large as the largest child
+    @GNUI_FLOW_PACKING_BALANCED:    Break the rows so that the space that they
+                                    leave is as even as possible (minimum
+                                    raggedness), the last row excluded
+
+    The strategies available for packing the children of a flow
+
+**/
+typedef enum GnuiFlowPacking {
+    GNUI_FLOW_PACKING_GREEDY,
+    GNUI_FLOW_PACKING_MASONRY,
+    GNUI_FLOW_PACKING_BALANCED
+} GnuiFlowPacking;
+
+
+/**
+
+    GNUI_TYPE_FLOW_PACKING:
+
+    The `GType` of `GnuiFlowPacking`
+
+**/
+#define GNUI_TYPE_FLOW_PACKING (gnui_flow_packing_get_type())
+
+
+/**
+
+    gnui_flow_packing_get_type:
+
+    Get the `GType` of `GnuiFlowPacking`
+
+    Returns:    The `GType` of the `GnuiFlowPacking` enumeration
+
+**/
+extern GType gnui_flow_packing_get_type (void) G_GNUC_CONST;
+
+
 /**
 
     GnuiFlowLayout:
@@ -164,6 +207,100 @@ struct _GnuiFlowLayoutClass {
 GtkLayoutManager * gnui_flow_layout_new (void) G_GNUC_WARN_UNUSED_RESULT;
 
 
+/**
+
+    gnui_flow_layout_get_index_at_pos:
+    @self:      (not nullable): The flow layout manager
+    @x:         The horizontal coordinate, relative to the widget that adopts
+                the layout manager
+    @y:         The vertical coordinate, relative to the widget that adopts
+                the layout manager
+
+    Get the index of the child found at a given position during the last
+    allocation
+
+    The lookup bisects the rows recorded during the allocation and then the
+    children of the row found, taking O(log rows + log children per row);
+    masonry packing has no rows, so the children laid out are scanned instead.
+    The index returned is the position of the child among all the children of
+    the widget, hidden children included (the same index used by
+    `gnui_flow_get_index_of_child()`): a `GnuiFlow` turns the child found into
+    its position in O(log n) thanks to its children index, while any other
+    widget needs a walk through the siblings. If the widget is a `GnuiFlow`
+    bound to a model, the index returned is the position of the item in the
+    model, whether the item is currently displayed or not (the items of the
+    row found are then walked, since only the rows are recorded).
+
+    Returns:    The index of the child found at the given position, or `-1` if
+                there is no child there
+
+**/
+extern gint gnui_flow_layout_get_index_at_pos (
+    GnuiFlowLayout * const self,
+    const gint x,
+    const gint y
+);
+
+
+/**
+
+    gnui_flow_layout_get_child_at_pos:
+    @self:      (not nullable): The flow layout manager
+    @x:         The horizontal coordinate, relative to the widget that adopts
+                the layout manager
+    @y:         The vertical coordinate, relative to the widget that adopts
+                the layout manager
+
+    Get the child found at a given position during the last allocation
+
+    Returns:    (transfer none) (nullable): The child found at the given
+                position, or `NULL` if there is no child there (or if the item
+                found there has no widget at the moment)
+
+**/
+extern GtkWidget * gnui_flow_layout_get_child_at_pos (
+    GnuiFlowLayout * const self,
+    const gint x,
+    const gint y
+);
+
+
+/**
+
+    gnui_flow_layout_get_child_rect:
+    @self:      (not nullable): The flow layout manager
+    @index:     The index of the child (as returned by
+                `gnui_flow_layout_get_index_at_pos()`)
+    @rect:      (out) (optional): A pointer for saving the rectangle that the
+                child occupied during the last allocation
+
+    Get the rectangle that a child occupied during the last allocation
+
+    This is useful for keyboard navigation and for scrolling to a child. The
+    index counts all the children of the widget, hidden children included, and
+    no rectangle is returned for children that were not laid out. If the
+    widget is a `GnuiFlow` bound to a model, @index is the position of the
+    item in the model and the rectangle is computed also for items that are
+    not displayed, using an estimated size for those that have never been
+    measured.
+
+    A `GnuiFlow` reaches the child in O(log n) thanks to its children index
+    and finds its rectangle in O(1) among the ones recorded by the allocation;
+    any other widget needs a walk through the siblings. For a `GnuiFlow` bound
+    to a model the rows are bisected and the items of the row found are
+    walked.
+
+    Returns:    `true` if @index refers to a child that was laid out, `false`
+                otherwise
+
+**/
+extern gboolean gnui_flow_layout_get_child_rect (
+    GnuiFlowLayout * const self,
+    const guint index,
+    GdkRectangle * const rect
+);
+
+
 /**
 
     gnui_flow_layout_get_spacing: (get-property spacing)
@@ -370,7 +507,7 @@ extern GtkJustification gnui_flow_layout_get_line_justify (
     @self:          (not nullable): The flow layout manager
     @justification: The flow layout manager's line justification
 
-    Set the flow layout manager's line justification                                    
+    Set the flow layout manager's line justification
 
 **/
 extern void gnui_flow_layout_set_line_justify (
@@ -379,6 +516,164 @@ extern void gnui_flow_layout_set_line_justify (
 );
 
 
+/**
+
+    gnui_flow_layout_get_positional_classes: (get-property positional-classes)
+    @self:      (not nullable): The flow layout manager
+
+    Get whether the children of the flow layout manager get positional CSS
+    classes
+
+    Returns:    `true` if the children get the `left`, `top`, `right` and
+                `bottom` CSS classes when they touch the corresponding edge,
+                `false` otherwise
+
+**/
+extern gboolean gnui_flow_layout_get_positional_classes (
+    GnuiFlowLayout * const self
+);
+
+
+/**
+
+    gnui_flow_layout_set_positional_classes: (set-property positional-classes)
+    @self:      (not nullable): The flow layout manager
+    @enabled:   Whether the children must get positional CSS classes
+
+    Set whether the children of the flow layout manager get the `left`, `top`,
+    `right` and `bottom` CSS classes when they touch the corresponding edge
+
+    These classes are enabled by default; disabling them removes them from all
+    the children and spares a style invalidation every time a child moves to
+    another edge, which matters in flows that are often resized and whose
+    stylesheet does not use them.
+
+**/
+extern void gnui_flow_layout_set_positional_classes (
+    GnuiFlowLayout * const self,
+    const gboolean enabled
+);
+
+
+/**
+
+    gnui_flow_layout_get_row_align: (get-property row-align)
+    @self:      (not nullable): The flow layout manager
+
+    Get the alignment of the children within their row
+
+    Returns:    The alignment of the children perpendicularly to the
+                orientation axis
+
+**/
+extern GtkAlign gnui_flow_layout_get_row_align (
+    GnuiFlowLayout * const self
+);
+
+
+/**
+
+    gnui_flow_layout_set_row_align: (set-property row-align)
+    @self:      (not nullable): The flow layout manager
+    @alignment: The alignment of the children perpendicularly to the
+                orientation axis
+
+    Set the alignment of the children within their row
+
+    With `GTK_ALIGN_FILL` (the default) the children are stretched to the size
+    of the row; with `GTK_ALIGN_START`, `GTK_ALIGN_CENTER` or `GTK_ALIGN_END`
+    they keep their natural size; with `GTK_ALIGN_BASELINE` the children of a
+    horizontal flow are aligned by their baselines and the rows grow as much as
+    needed to host them (children that do not report a baseline are aligned to
+    the start). Children that expand perpendicularly to the orientation axis
+    always fill their row.
+
+**/
+extern void gnui_flow_layout_set_row_align (
+    GnuiFlowLayout * const self,
+    const GtkAlign alignment
+);
+
+
+/**
+
+    gnui_flow_layout_get_packing: (get-property packing)
+    @self:      (not nullable): The flow layout manager
+
+    Get the strategy used for packing the children
+
+    Returns:    The packing strategy
+
+**/
+extern GnuiFlowPacking gnui_flow_layout_get_packing (
+    GnuiFlowLayout * const self
+);
+
+
+/**
+
+    gnui_flow_layout_set_packing: (set-property packing)
+    @self:      (not nullable): The flow layout manager
+    @packing:   The packing strategy
+
+    Set the strategy used for packing the children
+
+    With `GNUI_FLOW_PACKING_MASONRY` the children are placed in lanes as large
+    as the largest child, each one in the lane that is currently the shortest;
+    #GnuiFlowLayout:line-justify decides how the lanes share the space left and
+    #GnuiFlowLayout:leading separates the children of the same lane. With
+    `GNUI_FLOW_PACKING_BALANCED` the rows are broken as in
+    `GNUI_FLOW_PACKING_GREEDY`, except that a child can start a new row before
+    the current one is full, if this makes the rows more even (for each row
+    end only the 64 shortest candidate rows and the longest row that fits are
+    weighed, so the cost stays linear in the number of children and a row can
+    still host any number of them). Flows bound to a model are always packed
+    greedily.
+
+**/
+extern void gnui_flow_layout_set_packing (
+    GnuiFlowLayout * const self,
+    const GnuiFlowPacking packing
+);
+
+
+/**
+
+    gnui_flow_layout_get_homogeneous: (get-property homogeneous)
+    @self:      (not nullable): The flow layout manager
+
+    Get whether all the children get cells of the same size
+
+    Returns:    `true` if the flow is homogeneous, `false` otherwise
+
+**/
+extern gboolean gnui_flow_layout_get_homogeneous (
+    GnuiFlowLayout * const self
+);
+
+
+/**
+
+    gnui_flow_layout_set_homogeneous: (set-property homogeneous)
+    @self:          (not nullable): The flow layout manager
+    @homogeneous:   Whether all the children must get cells of the same size
+
+    Set whether all the children get cells of the same size
+
+    A homogeneous flow measures only its first few children and gives every
+    child a cell as large as the largest of them, computing the position of
+    each cell directly from the child's index; this makes resizing an icon
+    grid with thousands of identical cells cheap. Children larger than the
+    ones measured get less space than they request. A homogeneous flow is
+    always packed in a grid, whatever #GnuiFlowLayout:packing says.
+
+**/
+extern void gnui_flow_layout_set_homogeneous (
+    GnuiFlowLayout * const self,
+    const gboolean homogeneous
+);
+
+
 G_END_DECLS
 
 
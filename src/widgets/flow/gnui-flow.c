@@ -32,6 +32,7 @@
 
 #include <stdbool.h>
 #include <stdarg.h>
+#include <string.h>
 #include <gtk/gtk.h>
 #include "gnui-internals.h"
 #include "gnui-definitions.h"
@@ -46,6 +47,39 @@
 \*/
 
 
+/**
+
+    GNUI_FLOW_ASKED_SIZES:
+
+    The number of measurements along each dimension that a flow layout manager
+    remembers in order to tell a resize from a change in its children
+
+**/
+#define GNUI_FLOW_ASKED_SIZES 8
+
+
+/**
+
+    GNUI_FLOW_BALANCED_WINDOW:
+
+    The number of candidate lines that the balanced line breaker weighs for
+    each breakpoint, besides the longest line that fits
+
+**/
+#define GNUI_FLOW_BALANCED_WINDOW 64
+
+
+/**
+
+    GNUI_FLOW_HOMOGENEOUS_SAMPLE:
+
+    The number of children that a homogeneous flow measures in order to
+    decide the size of all its cells
+
+**/
+#define GNUI_FLOW_HOMOGENEOUS_SAMPLE 8
+
+
 /**
 
     GnuiOrientableAllocation:
@@ -142,11 +176,16 @@ enum {
 
 **/
 typedef struct _GnuiFlowRowInfo {
+	GnuiOrientableRequisition occupied_before;
 	guint
+		index,
+		n_ro_to_expand_before,
 		n_children,
 		n_ch_to_expand,
 		l_space,
-		row_size;
+		row_size,
+		baseline,
+		below_baseline;
 	bool
 		vexpand : 1,
 		starts_here : 1,
@@ -167,17 +206,123 @@ typedef struct _GnuiFlowChildLayoutPrivate GnuiFlowChildLayoutPrivate;
 
 struct _GnuiFlowChildLayoutPrivate {
 	GnuiOrientableAllocation allocation;
+	GnuiOrientableRequisition requisition;
 	GnuiOrientableCoordinates baselines;
 	GtkWidget * child;
 	GnuiFlowChildLayoutPrivate
 		* prev,
 		* next;
+	GSequenceIter * index_iter;
+	guint
+		requisition_serial,
+		indexed_slot;
+	GnuiOrientablePositionFlags orientable_flags;
 	GnuiPositionFlags pos_flags;
 	GnuiFlowRowInfo row;
-	bool fexpand;
+	bool
+		fexpand : 1,
+		pexpand : 1,
+		is_placed : 1,
+		is_frozen_out : 1,
+		breaks_before : 1;
 };
 
 
+/**
+
+    GnuiFlowLastPass:
+
+    What the flow layout manager remembers about its last allocation
+
+**/
+typedef struct _GnuiFlowLastPass {
+	GnuiFlowChildLayoutPrivate * first;
+	guint fix_size;
+	gint
+		spacing,
+		leading;
+	GtkJustification line_justify;
+	GtkTextDirection line_direction;
+	GtkAlign row_align;
+	GnuiFlowPacking packing;
+	bool page_is_stable;
+} GnuiFlowLastPass;
+
+
+/**
+
+    GnuiFlowIndexedRow:
+
+    A row as recorded by the flow layout manager's row index
+
+**/
+typedef struct _GnuiFlowIndexedRow {
+	gint var_axis;
+	guint
+		var_size,
+		first_child;
+} GnuiFlowIndexedRow;
+
+
+/**
+
+    GnuiFlowIndexedChild:
+
+    A child as recorded by the flow layout manager's row index
+
+**/
+typedef struct _GnuiFlowIndexedChild {
+	GtkAllocation allocation;
+	GtkWidget * child;
+} GnuiFlowIndexedChild;
+
+
+/**
+
+    GnuiFlowBreakpoint:
+
+    A feasible line break for the balanced line breaker
+
+**/
+typedef struct _GnuiFlowBreakpoint {
+	guint64
+		cost,
+		offset;
+	guint from;
+	GnuiFlowChildLayoutPrivate * chinfo;
+} GnuiFlowBreakpoint;
+
+
+/**
+
+    GnuiFlowLane:
+
+    A lane of a flow packed as masonry
+
+**/
+typedef struct _GnuiFlowLane {
+	guint var_size;
+	GnuiFlowChildLayoutPrivate * last;
+	GnuiOrientablePositionFlags last_flags;
+} GnuiFlowLane;
+
+
+/**
+
+    GnuiFlowAskedSizes:
+
+    The sizes for which a flow has been measured along one dimension since the
+    cached size requests of its children were invalidated
+
+**/
+typedef struct _GnuiFlowAskedSizes {
+	gint for_sizes[GNUI_FLOW_ASKED_SIZES];
+	guint
+		length,
+		next;
+} GnuiFlowAskedSizes;
+
+
 /**
 
     GnuiFlowLayoutPrivate:
@@ -190,16 +335,144 @@ typedef struct _GnuiFlowLayoutPrivate {
 	GtkJustification
 		line_justify,
 		page_justify;
+	GtkAlign row_align;
+	GnuiFlowPacking packing;
 	gint
 		spacing,
 		leading;
 	GtkTextDirection
 		page_direction,
 		line_direction;
-	guint allocated_fix_size;
+	guint
+		allocated_fix_size,
+		measured_fix_size,
+		measure_serial,
+		indexed_fix_size;
+	GnuiFlowLastPass last_pass;
+	GnuiFlowAskedSizes asked_sizes[2];
+	GArray
+		* indexed_rows,
+		* indexed_children,
+		* breakpoints;
+	GnuiOrientablePositionFlags indexed_flags;
+	bool
+		positional_classes : 1,
+		homogeneous : 1;
 } GnuiFlowLayoutPrivate;
 
 
+/**
+
+    GnuiFlowModelItem:
+
+    Private data of an item of the model bound to a flow widget
+
+**/
+typedef struct _GnuiFlowModelItem {
+	GnuiOrientableRequisition requisition;
+	GtkWidget * widget;
+	bool is_measured;
+} GnuiFlowModelItem;
+
+
+/**
+
+    GnuiFlowModelRow:
+
+    A row of items of the model bound to a flow widget
+
+**/
+typedef struct _GnuiFlowModelRow {
+	guint
+		first_item,
+		n_items,
+		used_size,
+		row_size;
+	gint var_axis;
+} GnuiFlowModelRow;
+
+
+/**
+
+    GnuiFlowFrozenSize:
+
+    A size measured by the flow layout manager, replayed while the flow is
+    being updated
+
+    Each dimension keeps two of them: the last one measured without a
+    `for_size` and the last one measured for a given `for_size`.
+
+**/
+typedef struct _GnuiFlowFrozenSize {
+	gint
+		for_size,
+		minimum,
+		natural;
+} GnuiFlowFrozenSize;
+
+
+/**
+
+    GnuiFlowPrivate:
+
+    Flow widget's private data
+
+    The `frozen_edges` member holds the first and the last child as they were
+    when the hidden children were last looked for, while `has_new_children`
+    tells whether children have been inserted since then; both are compared
+    only as pointers.
+
+    The `rows` member caches how the items of the model were last broken into
+    rows, together with what the breaks depend on (the `rows_*` members);
+    `rows_stale_item` is the first item whose row must be broken again
+    (`G_MAXUINT` if the rows are up to date), while `rows_are_indexed`,
+    `indexed_p_shift` and `indexed_span` tell whether the layout manager's
+    index of the rows still reflects them.
+
+**/
+typedef struct _GnuiFlowPrivate {
+	GnuiOrientableRequisition max_requisition;
+	guint64
+		measured_fix_sum,
+		measured_var_sum;
+	GListModel * model;
+	GnuiFlowCreateWidgetFunc create_widget_func;
+	GnuiFlowBindWidgetFunc bind_widget_func;
+	gpointer user_data;
+	GDestroyNotify user_data_free_func;
+	GArray
+		* items,
+		* rows;
+	GPtrArray * pool;
+	GSequence * children_index;
+	GtkAdjustment * adjustments[2];
+	GnuiOrientableRequisition rows_estimate;
+	GtkOrientation rows_orientation;
+	gulong
+		items_changed_handler,
+		value_changed_handlers[2];
+	gint
+		rows_spacing,
+		rows_leading;
+	guint
+		n_measured,
+		first_unmeasured,
+		rows_fix_size,
+		rows_extent,
+		rows_stale_item,
+		indexed_p_shift,
+		indexed_span,
+		bound_start,
+		bound_end,
+		update_depth;
+	GnuiFlowFrozenSize frozen_sizes[2][2];
+	GtkWidget * frozen_edges[2];
+	bool
+		has_new_children,
+		rows_are_indexed;
+} GnuiFlowPrivate;
+
+
 static void gnui_flow_buildable_init (
 	GtkBuildableIface * iface
 );
@@ -229,7 +502,9 @@ G_DEFINE_TYPE_WITH_CODE(
 	GnuiFlow,
 	gnui_flow,
 	GTK_TYPE_WIDGET,
-	G_IMPLEMENT_INTERFACE(
+	G_ADD_PRIVATE(
+		GnuiFlow
+	) G_IMPLEMENT_INTERFACE(
 		GTK_TYPE_ORIENTABLE,
 		NULL
 	) G_IMPLEMENT_INTERFACE(
@@ -258,6 +533,10 @@ typedef enum _GnuiFlowLayoutProperty {
     FLOW_LAYOUT_PROPERTY_PAGE_JUSTIFY,
     FLOW_LAYOUT_PROPERTY_LINE_DIRECTION,
     FLOW_LAYOUT_PROPERTY_LINE_JUSTIFY,
+    FLOW_LAYOUT_PROPERTY_POSITIONAL_CLASSES,
+    FLOW_LAYOUT_PROPERTY_ROW_ALIGN,
+    FLOW_LAYOUT_PROPERTY_PACKING,
+    FLOW_LAYOUT_PROPERTY_HOMOGENEOUS,
 
     /*  Number of properties  */
     N_FLOW_LAYOUT_PROPERTIES,
@@ -287,6 +566,10 @@ typedef enum _GnuiFlowProperty {
     FLOW_PROPERTY_PAGE_JUSTIFY,
     FLOW_PROPERTY_LINE_DIRECTION,
     FLOW_PROPERTY_LINE_JUSTIFY,
+    FLOW_PROPERTY_POSITIONAL_CLASSES,
+    FLOW_PROPERTY_ROW_ALIGN,
+    FLOW_PROPERTY_PACKING,
+    FLOW_PROPERTY_HOMOGENEOUS,
 
     /*  Number of properties  */
     N_FLOW_PROPERTIES,
@@ -325,12 +608,24 @@ static GtkBuildableIface * parent_buildable_iface;
 
     Update the flow children's positional CSS classes
 
+    Nothing is done if the child's position has not changed since the last
+    time; otherwise only the CSS classes that differ are touched (every change
+    invalidates the child's style).
+
 **/
 static void gnui_flow_chinfo_update_style_classes (
 	GnuiFlowChildLayoutPrivate * const chinfo,
 	const GnuiOrientablePositionFlags flags
 ) {
 
+	if (chinfo->orientable_flags == flags) {
+
+		return;
+
+	}
+
+	chinfo->orientable_flags = flags;
+
 	GnuiPositionFlags pos_new_flags = GNUI_ORIENTABLE_POSITION_FLAG_NONE;
 
 	switch (
@@ -454,6 +749,12 @@ static void gnui_flow_chinfo_update_style_classes (
 
 	}
 
+	if (chinfo->pos_flags == pos_new_flags) {
+
+		return;
+
+	}
+
 	GtkWidget * const child = chinfo->child;
 	GnuiPositionFlags _tmp_posflags_1_;
 
@@ -491,210 +792,3468 @@ static void gnui_flow_chinfo_update_style_classes (
 }
 
 
-/*  GnuiFlowLayout and GnuiFlowChildLayout  */
-
-
 /**
 
-    gnui_flow_layout_update_orientation:
-    @manager:       (not nullable): The flow layout manager
-    @widget:        (not nullable): The widget currently adopting the flow
-                    layout manager
-    @orientation:   The flow layout manager's orientation
+    gnui_flow_chinfo_ensure_requisition:
+    @chinfo:    (not nullable): Private `struct` of a `GnuiFlowChildLayout`
+    @child:     (not nullable): The child widget
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
 
-    Update the flow layout manager's orientation
+    Make sure that the cached size request of a flow child is still valid; the
+    child is measured again only if it is not
+
+    GTK does not notify layout managers about single children queueing a
+    resize, so the cached size requests of all the children are invalidated
+    only when GTK repeats a measurement that it had already requested (see
+    `gnui_flow_layout_note_measure()`) or when the orientation changes; the
+    children added since then have never been measured and always are. The
+    size requests are taken with no size in the other dimension, so that they
+    stay valid whatever size the flow is measured for, and resizes reuse them.
 
 **/
-static void gnui_flow_layout_update_orientation (
-	GnuiFlowLayout * const manager,
-	GtkWidget * const widget,
-	const GtkOrientation orientation
+static inline void gnui_flow_chinfo_ensure_requisition (
+	GnuiFlowChildLayoutPrivate * const chinfo,
+	GtkWidget * const child,
+	const GnuiFlowLayoutPrivate * const priv
 ) {
 
-	GnuiFlowLayoutPrivate * const priv =
-		gnui_flow_layout_get_instance_private(manager);
-
-	if (priv->orientation == orientation) {
+	if (chinfo->requisition_serial == priv->measure_serial) {
 
 		return;
 
 	}
 
-	priv->orientation = orientation;
-	priv->allocated_fix_size = 0;
-
-	if (orientation == GTK_ORIENTATION_VERTICAL) {
-
-		gtk_widget_add_css_class(widget, "vertical");
-		gtk_widget_remove_css_class(widget, "horizontal");
-
-	} else {
-
-		gtk_widget_add_css_class(widget, "horizontal");
-		gtk_widget_remove_css_class(widget, "vertical");
-	}
+	gtk_widget_measure(
+		child,
+		priv->orientation,
+		-1,
+		NULL,
+		(gint *) &chinfo->requisition.fix_size,
+		NULL,
+		&chinfo->baselines.fix_axis
+	);
 
-	gtk_accessible_update_property(
-		GTK_ACCESSIBLE(widget),
-		GTK_ACCESSIBLE_PROPERTY_ORIENTATION,
-		orientation,
-		-1
+	gtk_widget_measure(
+		child,
+		GNUI_PERPENDICULAR_ORIENTATION(priv->orientation),
+		-1,
+		NULL,
+		(gint *) &chinfo->requisition.var_size,
+		NULL,
+		&chinfo->baselines.var_axis
 	);
 
-	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(manager));
-	g_object_notify(G_OBJECT(manager), "orientation");
+	GNUI_NORMALIZE_INT_UINT_CAST__2(chinfo->requisition.fix_size);
+	GNUI_NORMALIZE_INT_UINT_CAST__2(chinfo->requisition.var_size);
+	chinfo->requisition_serial = priv->measure_serial;
 
 }
 
 
 /**
 
-    gnui_flow_layout_measure:
-    @manager:           (auto) (not nullable): The flow layout manager
-    @widget:            (auto) (not nullable): The widget currently adopting
-                        the flow layout manager
-    @dimension:         (auto): The dimension that is being queried
-    @for_size:          (auto): The size of the other dimension, or `-1` if
-                        this is unknown
-    @minimum_size:      (auto) (optional) (out): A pointer for saving the
-						calculated minimum size
-    @natural_size:      (auto) (optional) (out): A pointer for saving the
-						calculated natural size
-    @minimum_baseline:  (auto) (optional) (out): A pointer for saving the
-						calculated minimum baseline
-    @natural_baseline:  (auto) (optional) (out): A pointer for saving the
-						calculated natural baseline
+    gnui_flow_row_fit_child:
+    @row_size:          (not nullable) (inout): The size of the row
+    @baseline:          (not nullable) (inout): The baseline of the row
+    @below_baseline:    (not nullable) (inout): The space that the row needs
+                        below its baseline
+    @child_size:        The child's size perpendicularly to the orientation
+                        axis
+    @child_baseline:    The child's baseline, or `-1` if the child must not be
+                        aligned by its baseline
 
-    Class handler for the #GtkLayoutManager.measure() method on the flow layout
-    manager instance
+    Grow a row so that it can host a child
 
 **/
-static void gnui_flow_layout_measure (
-	GtkLayoutManager * const manager,
-	GtkWidget * const widget,
-	const GtkOrientation dimension,
-	const gint for_size,
-	gint * const minimum_size,
-	gint * const natural_size,
-	gint * const minimum_baseline,
-	gint * const natural_baseline
+static inline void gnui_flow_row_fit_child (
+	guint * const row_size,
+	guint * const baseline,
+	guint * const below_baseline,
+	const guint child_size,
+	const gint child_baseline
 ) {
 
-	const GnuiFlowLayoutPrivate * const priv =
-		gnui_flow_layout_get_instance_private(GNUI_FLOW_LAYOUT(manager));
+	GNUI_SET_IF_GREATER__2_2(*row_size, child_size);
 
-	GtkWidget * child;
-	gint ret_min = 0, ret_nat = 0;
+	if (child_baseline < 0) {
 
-	const guint space =
-		dimension == priv->orientation ?
-			0
-		: priv->allocated_fix_size > 0 ?
-			priv->allocated_fix_size
-		: for_size > -1 ?
-			*((guint *) &for_size)
-		:
-			0;
+		return;
 
-	if (space == 0) {
+	}
 
-		#define tmpint ret_min
+	GNUI_SET_IF_GREATER__2_2(*baseline, (guint) child_baseline);
+	GNUI_SET_IF_GREATER__2_2(*below_baseline, child_size - child_baseline);
+	GNUI_SET_IF_GREATER__2_2(*row_size, *baseline + *below_baseline);
 
-		for (
-			child = gtk_widget_get_first_child(widget);
-				child;
-			child = gtk_widget_get_next_sibling(child)
-		) {
+}
 
-			gtk_widget_measure(
-				child,
-				dimension,
-				-1,
-				NULL,
-				&tmpint,
-				NULL,
-				NULL
-			);
 
-			GNUI_SET_IF_GREATER__2_2(ret_nat, tmpint);
+/**
 
-		}
+    gnui_flow_align_in_row:
+    @row_align:         The row alignment
+    @child_size:        The child's size perpendicularly to the orientation
+                        axis
+    @child_baseline:    The child's baseline, or `-1`
+    @row_baseline:      The baseline of the row
+    @var_axis:          (not nullable) (inout): The child's position
+                        perpendicularly to the orientation axis, initially
+                        equal to the position of the row
+    @var_size:          (not nullable) (inout): The child's size
+                        perpendicularly to the orientation axis, initially
+                        equal to the size of the row
 
-		#undef tmpint
+    Align a child within its row (children without a baseline are aligned to
+    the start when @row_align is `GTK_ALIGN_BASELINE`)
 
-		ret_min = ret_nat;
-		goto save_and_exit;
+    Returns:    The baseline to allocate for the child, or `-1`
+
+**/
+static inline gint gnui_flow_align_in_row (
+	const GtkAlign row_align,
+	const guint child_size,
+	const gint child_baseline,
+	const guint row_baseline,
+	gint * const var_axis,
+	gint * const var_size
+) {
+
+	if (row_align == GTK_ALIGN_FILL || (gint) child_size >= *var_size) {
+
+		return row_align == GTK_ALIGN_BASELINE ? child_baseline : -1;
 
 	}
 
-	GnuiOrientableAllocation
-		nexta, preva = { 0 };
+	switch (row_align) {
 
-	GnuiOrientableRequisition occupied = {
-		.fix_size = space,
-		.var_size = 0
-	};
+		case GTK_ALIGN_END:
 
-	guint row_size = 0;
+			*var_axis += *var_size - child_size;
+			break;
 
-	for (
-		child = gtk_widget_get_first_child(widget);
-			child;
-		child = gtk_widget_get_next_sibling(child)
-	) {
+		case GTK_ALIGN_CENTER:
 
-		if (!gtk_widget_should_layout(child)) {
+			*var_axis += (*var_size - (gint) child_size) / 2;
+			break;
 
-			continue;
+		case GTK_ALIGN_BASELINE:
 
-		}
+			if (child_baseline > -1) {
 
-		gtk_widget_measure(
-			child,
-			priv->orientation,
-			-1,
-			NULL,
-			(gint *) &nexta.fix_size,
-			NULL,
+				*var_axis += row_baseline - child_baseline;
+				*var_size = child_size;
+				return child_baseline;
+
+			}
+
+			break;
+
+		default:
+
+			break;
+
+	}
+
+	*var_size = child_size;
+	return -1;
+
+}
+
+
+/**
+
+    gnui_flow_chinfo_mark_placed:
+    @chinfo:    (not nullable): Private `struct` of a `GnuiFlowChildLayout`
+    @child:     (not nullable): The child owning @chinfo
+
+    Remember that a child has been placed, showing it again if it had been
+    hidden while the flow was being updated
+
+**/
+static inline void gnui_flow_chinfo_mark_placed (
+	GnuiFlowChildLayoutPrivate * const chinfo,
+	GtkWidget * const child
+) {
+
+	if (chinfo->is_frozen_out) {
+
+		gtk_widget_set_child_visible(child, true);
+		chinfo->is_frozen_out = false;
+
+	}
+
+	chinfo->is_placed = true;
+
+}
+
+
+/**
+
+    gnui_flow_rect_get_fix_extremes:
+    @rect:          (not nullable): A child's allocation
+    @is_vertical:   Whether the flow is vertical
+    @start:         (not nullable) (out): A pointer for saving where @rect
+                    begins along the orientation axis
+    @end:           (not nullable) (out): A pointer for saving where @rect
+                    ends along the orientation axis
+
+    Get the extremes of a rectangle along the orientation axis
+
+**/
+static inline void gnui_flow_rect_get_fix_extremes (
+	const GtkAllocation * const rect,
+	const bool is_vertical,
+	gint * const start,
+	gint * const end
+) {
+
+	if (is_vertical) {
+
+		*start = rect->y;
+		*end = rect->y + rect->height;
+
+	} else {
+
+		*start = rect->x;
+		*end = rect->x + rect->width;
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow_row_init:
+    @roinfo:                    (not nullable): The row's private data
+    @index:                     The index of the row
+    @n_ro_to_expand_before:     The number of rows to expand that precede
+                                this row
+    @occupied_before:           (not nullable): The space occupied by the rows
+                                that precede this row
+    @row_size:                  The initial size of the row
+
+    Initialize a row that starts with the child owning @roinfo
+
+**/
+static inline void gnui_flow_row_init (
+	GnuiFlowRowInfo * const roinfo,
+	const guint index,
+	const guint n_ro_to_expand_before,
+	const GnuiOrientableRequisition * const occupied_before,
+	const guint row_size
+) {
+
+	*roinfo = (GnuiFlowRowInfo) {
+		.occupied_before = *occupied_before,
+		.index = index,
+		.n_ro_to_expand_before = n_ro_to_expand_before,
+		.n_children = 1,
+		.row_size = row_size,
+		.starts_here = true
+	};
+
+}
+
+
+/*  Model-backed flows  */
+
+
+/**
+
+    gnui_flow_has_model:
+    @self:      (not nullable): The flow widget
+
+    Check whether a model is bound to a flow widget
+
+    Returns:    `true` if a model is bound to @self, `false` otherwise
+
+**/
+static inline bool gnui_flow_has_model (
+	GnuiFlow * const self
+) {
+
+	return (
+		(GnuiFlowPrivate *) gnui_flow_get_instance_private(self)
+	)->model != NULL;
+
+}
+
+
+/**
+
+    gnui_flow_model_get_estimate:
+    @fpriv:     (not nullable): Private `struct` of the `GnuiFlow`
+    @dest:      (not nullable) (out): A pointer for saving the estimate
+
+    Estimate the size of the items that have never been measured
+
+**/
+static inline void gnui_flow_model_get_estimate (
+	const GnuiFlowPrivate * const fpriv,
+	GnuiOrientableRequisition * const dest
+) {
+
+	if (fpriv->n_measured) {
+
+		dest->fix_size = fpriv->measured_fix_sum / fpriv->n_measured;
+		dest->var_size = fpriv->measured_var_sum / fpriv->n_measured;
+
+	} else {
+
+		dest->fix_size = 0;
+		dest->var_size = 0;
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow_model_release_item:
+    @fpriv:     (not nullable): Private `struct` of the `GnuiFlow`
+    @item:      (not nullable): The item that must release its widget
+
+    Hide the widget bound to an item and put it back in the pool of widgets
+    available for recycling
+
+**/
+static inline void gnui_flow_model_release_item (
+	GnuiFlowPrivate * const fpriv,
+	GnuiFlowModelItem * const item
+) {
+
+	if (!item->widget) {
+
+		return;
+
+	}
+
+	gtk_widget_set_child_visible(item->widget, false);
+	g_ptr_array_add(fpriv->pool, item->widget);
+	item->widget = NULL;
+
+}
+
+
+/**
+
+    gnui_flow_model_release_all:
+    @fpriv:     (not nullable): Private `struct` of the `GnuiFlow`
+
+    Release the widgets of all the items that are currently bound
+
+**/
+static void gnui_flow_model_release_all (
+	GnuiFlowPrivate * const fpriv
+) {
+
+	for (guint idx = fpriv->bound_start; idx < fpriv->bound_end; idx++) {
+
+		gnui_flow_model_release_item(
+			fpriv,
+			&g_array_index(fpriv->items, GnuiFlowModelItem, idx)
+		);
+
+	}
+
+	fpriv->bound_start = 0;
+	fpriv->bound_end = 0;
+
+}
+
+
+/**
+
+    gnui_flow_model_invalidate_rows:
+    @fpriv:     (not nullable): Private `struct` of the `GnuiFlow`
+    @index:     The first item whose size or presence has changed
+
+    Mark the row breaks of the model as stale from a given item onward
+
+**/
+static inline void gnui_flow_model_invalidate_rows (
+	GnuiFlowPrivate * const fpriv,
+	const guint index
+) {
+
+	if (index < fpriv->rows_stale_item) {
+
+		fpriv->rows_stale_item = index;
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow_model_bind_item:
+    @flow:      (not nullable): The flow widget
+    @fpriv:     (not nullable): Private `struct` of @flow
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @index:     The index of the item to bind
+
+    Make sure that an item has a widget (recycling one from the pool or
+    creating a new one) and measure it
+
+    Returns:    `true` if the size of the item differs from what was assumed
+                before, `false` otherwise
+
+**/
+static bool gnui_flow_model_bind_item (
+	GtkWidget * const flow,
+	GnuiFlowPrivate * const fpriv,
+	const GnuiFlowLayoutPrivate * const priv,
+	const guint index
+) {
+
+	GnuiFlowModelItem * const item =
+		&g_array_index(fpriv->items, GnuiFlowModelItem, index);
+
+	GnuiOrientableRequisition requisition;
+
+	if (!item->widget) {
+
+		gpointer const model_item = g_list_model_get_item(fpriv->model, index);
+
+		if (fpriv->pool->len) {
+
+			item->widget = g_ptr_array_remove_index_fast(
+				fpriv->pool,
+				fpriv->pool->len - 1
+			);
+
+			gtk_widget_set_child_visible(item->widget, true);
+
+		} else {
+
+			item->widget = fpriv->create_widget_func(fpriv->user_data);
+			gtk_widget_set_parent(item->widget, flow);
+
+		}
+
+		fpriv->bind_widget_func(item->widget, model_item, fpriv->user_data);
+		g_object_unref(model_item);
+
+	}
+
+	gtk_widget_measure(
+		item->widget,
+		priv->orientation,
+		-1,
+		NULL,
+		(gint *) &requisition.fix_size,
+		NULL,
+		NULL
+	);
+
+	gtk_widget_measure(
+		item->widget,
+		GNUI_PERPENDICULAR_ORIENTATION(priv->orientation),
+		-1,
+		NULL,
+		(gint *) &requisition.var_size,
+		NULL,
+		NULL
+	);
+
+	GNUI_NORMALIZE_INT_UINT_CAST__2(requisition.fix_size);
+	GNUI_NORMALIZE_INT_UINT_CAST__2(requisition.var_size);
+
+	if (!item->is_measured) {
+
+		item->is_measured = true;
+		fpriv->n_measured++;
+
+	} else if (
+		item->requisition.fix_size == requisition.fix_size &&
+		item->requisition.var_size == requisition.var_size
+	) {
+
+		return false;
+
+	} else {
+
+		fpriv->measured_fix_sum -= item->requisition.fix_size;
+		fpriv->measured_var_sum -= item->requisition.var_size;
+
+	}
+
+	item->requisition = requisition;
+	fpriv->measured_fix_sum += requisition.fix_size;
+	fpriv->measured_var_sum += requisition.var_size;
+	gnui_flow_model_invalidate_rows(fpriv, index);
+
+	GNUI_SET_IF_GREATER__2_2(
+		fpriv->max_requisition.fix_size,
+		requisition.fix_size
+	);
+
+	GNUI_SET_IF_GREATER__2_2(
+		fpriv->max_requisition.var_size,
+		requisition.var_size
+	);
+
+	return true;
+
+}
+
+
+/**
+
+    gnui_flow_model_ensure_estimate:
+    @flow:      (not nullable): The flow widget
+    @fpriv:     (not nullable): Private `struct` of @flow
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+
+    Make sure that at least one item of the model has been measured, so that
+    the size of the others can be estimated
+
+    Returns:    `true` if an item had to be measured, `false` otherwise
+
+**/
+static bool gnui_flow_model_ensure_estimate (
+	GtkWidget * const flow,
+	GnuiFlowPrivate * const fpriv,
+	const GnuiFlowLayoutPrivate * const priv
+) {
+
+	if (fpriv->n_measured || !fpriv->items->len) {
+
+		return false;
+
+	}
+
+	gnui_flow_model_bind_item(flow, fpriv, priv, 0);
+
+	gnui_flow_model_release_item(
+		fpriv,
+		&g_array_index(fpriv->items, GnuiFlowModelItem, 0)
+	);
+
+	return true;
+
+}
+
+
+/**
+
+    gnui_flow_model_break_rows:
+    @fpriv:     (not nullable): Private `struct` of the `GnuiFlow`
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @fix_size:  The available size along the orientation axis
+    @from_row:  The index of the first row to break (the rows before it are
+                kept as they are); must be zero if @dest is `NULL`
+    @dest:      (nullable) (out): An array of `GnuiFlowModelRow` where to save
+                the rows, or `NULL` if only their extent is needed
+
+    Break the items of the model into rows, using the estimated size for the
+    items that have never been measured
+
+    Returns:    The size occupied by all the rows along the perpendicular axis
+
+**/
+static guint gnui_flow_model_break_rows (
+	const GnuiFlowPrivate * const fpriv,
+	const GnuiFlowLayoutPrivate * const priv,
+	const guint fix_size,
+	const guint from_row,
+	GArray * const dest
+) {
+
+	const guint n_items = fpriv->items->len;
+	GnuiOrientableRequisition estimate;
+	const GnuiOrientableRequisition * requisition;
+	GnuiFlowModelRow row = { 0 };
+	gint extent = 0, var_axis = 0;
+	guint idx = 0;
+
+	if (from_row) {
+
+		row = g_array_index(dest, GnuiFlowModelRow, from_row - 1);
+		idx = row.first_item + row.n_items;
+		extent = row.var_axis + (gint) row.row_size;
+		var_axis = extent + priv->leading;
+		row.n_items = 0;
+
+	}
+
+	if (dest) {
+
+		g_array_set_size(dest, from_row);
+
+	}
+
+	if (idx >= n_items) {
+
+		return (guint) extent;
+
+	}
+
+	gnui_flow_model_get_estimate(fpriv, &estimate);
+
+	for (; idx < n_items; idx++) {
+
+		requisition =
+			g_array_index(fpriv->items, GnuiFlowModelItem, idx).is_measured ?
+				&g_array_index(fpriv->items, GnuiFlowModelItem, idx).requisition
+			:
+				&estimate;
+
+		if (
+			row.n_items &&
+			row.used_size + requisition->fix_size + priv->spacing <= fix_size
+		) {
+
+			row.used_size += requisition->fix_size + priv->spacing;
+			row.n_items++;
+			GNUI_SET_IF_GREATER__2_2(row.row_size, requisition->var_size);
+
+		} else {
+
+			if (row.n_items) {
+
+				if (dest) {
+
+					g_array_append_val(dest, row);
+
+				}
+
+				var_axis = row.var_axis + (gint) row.row_size + priv->leading;
+
+			}
+
+			row = (GnuiFlowModelRow) {
+				.first_item = idx,
+				.n_items = 1,
+				.used_size = requisition->fix_size,
+				.row_size = requisition->var_size,
+				.var_axis = var_axis
+			};
+
+		}
+
+		GNUI_SET_IF_GREATER__2_2(extent, row.var_axis + (gint) row.row_size);
+
+	}
+
+	if (dest) {
+
+		g_array_append_val(dest, row);
+
+	}
+
+	return (guint) extent;
+
+}
+
+
+/**
+
+    gnui_flow_model_find_row:
+    @fpriv:     (not nullable): Private `struct` of the `GnuiFlow`
+    @offset:    An offset along the perpendicular axis
+    @by_end:    Whether to compare @offset with the end of the rows rather
+                than with their beginning
+
+    Perform a binary search on the rows of the model
+
+    Returns:    The index of the first row that ends (if @by_end is `true`) or
+                begins (if @by_end is `false`) after @offset, or the number of
+                rows if there is no such row
+
+**/
+static guint gnui_flow_model_find_row (
+	const GnuiFlowPrivate * const fpriv,
+	const gint64 offset,
+	const bool by_end
+) {
+
+	const GnuiFlowModelRow * row;
+	guint middle, lower = 0, upper = fpriv->rows->len;
+
+	while (lower < upper) {
+
+		middle = lower + (upper - lower) / 2;
+		row = &g_array_index(fpriv->rows, GnuiFlowModelRow, middle);
+
+		if (
+			(by_end ? row->var_axis + (gint64) row->row_size : row->var_axis) >
+				offset
+		) {
+
+			upper = middle;
+
+		} else {
+
+			lower = middle + 1;
+
+		}
+
+	}
+
+	return lower;
+
+}
+
+
+/**
+
+    gnui_flow_model_find_item_row:
+    @fpriv:     (not nullable): Private `struct` of the `GnuiFlow`
+    @index:     The index of an item
+
+    Perform a binary search on the rows of the model
+
+    Returns:    The index of the last row that begins at or before @index, or
+                zero if there is no such row
+
+**/
+static guint gnui_flow_model_find_item_row (
+	const GnuiFlowPrivate * const fpriv,
+	const guint index
+) {
+
+	guint middle, lower = 0, upper = fpriv->rows->len;
+
+	while (lower < upper) {
+
+		middle = lower + (upper - lower) / 2;
+
+		if (
+			g_array_index(fpriv->rows, GnuiFlowModelRow, middle).first_item >
+				index
+		) {
+
+			upper = middle;
+
+		} else {
+
+			lower = middle + 1;
+
+		}
+
+	}
+
+	return lower ? lower - 1 : 0;
+
+}
+
+
+/**
+
+    gnui_flow_model_ensure_rows:
+    @fpriv:     (not nullable): Private `struct` of the `GnuiFlow`
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @fix_size:  The available size along the orientation axis
+
+    Make sure that the rows of the model are broken for a given size, breaking
+    again only the rows that have become stale
+
+    The rows are kept as long as the available size, the spacing, the leading
+    and the orientation do not change; a change in the size of an item (or in
+    the model) makes stale only the rows from the one that precedes the item,
+    while a change in the estimated size makes stale only the rows from the
+    first item that has never been measured. Scrolling therefore costs nothing
+    here.
+
+    Returns:    The size occupied by all the rows along the perpendicular axis
+
+**/
+static guint gnui_flow_model_ensure_rows (
+	GnuiFlowPrivate * const fpriv,
+	const GnuiFlowLayoutPrivate * const priv,
+	const guint fix_size
+) {
+
+	GnuiOrientableRequisition estimate;
+
+	gnui_flow_model_get_estimate(fpriv, &estimate);
+
+	if (
+		fpriv->rows_fix_size != fix_size ||
+		fpriv->rows_spacing != priv->spacing ||
+		fpriv->rows_leading != priv->leading ||
+		fpriv->rows_orientation != priv->orientation
+	) {
+
+		fpriv->rows_stale_item = 0;
+
+	} else if (
+		fpriv->rows_estimate.fix_size != estimate.fix_size ||
+		fpriv->rows_estimate.var_size != estimate.var_size
+	) {
+
+		while (
+			fpriv->first_unmeasured < fpriv->items->len &&
+			g_array_index(
+				fpriv->items,
+				GnuiFlowModelItem,
+				fpriv->first_unmeasured
+			).is_measured
+		) {
+
+			fpriv->first_unmeasured++;
+
+		}
+
+		if (fpriv->first_unmeasured < fpriv->items->len) {
+
+			gnui_flow_model_invalidate_rows(fpriv, fpriv->first_unmeasured);
+
+		}
+
+	}
+
+	if (fpriv->rows_stale_item == G_MAXUINT) {
+
+		return fpriv->rows_extent;
+
+	}
+
+	/*  An item that shrinks might now fit in the row that precedes it  */
+	fpriv->rows_extent = gnui_flow_model_break_rows(
+		fpriv,
+		priv,
+		fix_size,
+		gnui_flow_model_find_item_row(
+			fpriv,
+			fpriv->rows_stale_item ? fpriv->rows_stale_item - 1 : 0
+		),
+		fpriv->rows
+	);
+
+	fpriv->rows_estimate = estimate;
+	fpriv->rows_orientation = priv->orientation;
+	fpriv->rows_spacing = priv->spacing;
+	fpriv->rows_leading = priv->leading;
+	fpriv->rows_fix_size = fix_size;
+	fpriv->rows_stale_item = G_MAXUINT;
+	fpriv->rows_are_indexed = false;
+
+	return fpriv->rows_extent;
+
+}
+
+
+/**
+
+    gnui_flow_model_begin_row:
+    @priv:                  (not nullable): Private `struct` of the
+                            `GnuiFlowLayout`
+    @row:                   (not nullable): The row of items
+    @fix_size:              The available size along the orientation axis
+    @l_exp_quota:           (not nullable) (out): A pointer for saving the
+                            space that every item receives in addition to its
+                            size
+    @l_n_larger_exp_quota:  (not nullable) (out): A pointer for saving the
+                            number of items (starting from the first one) that
+                            receive one more pixel
+
+    Compute how a row of items is justified
+
+    Returns:    The logical offset of the first item along the orientation
+                axis
+
+**/
+static guint gnui_flow_model_begin_row (
+	const GnuiFlowLayoutPrivate * const priv,
+	const GnuiFlowModelRow * const row,
+	const guint fix_size,
+	guint * const l_exp_quota,
+	guint * const l_n_larger_exp_quota
+) {
+
+	const guint l_space =
+		fix_size > row->used_size ?
+			fix_size - row->used_size
+		:
+			0;
+
+	if (priv->line_justify == GTK_JUSTIFY_FILL) {
+
+		*l_exp_quota = l_space / row->n_items;
+		*l_n_larger_exp_quota = l_space % row->n_items;
+		return 0;
+
+	}
+
+	*l_exp_quota = 0;
+	*l_n_larger_exp_quota = 0;
+
+	return
+		priv->line_justify == GTK_JUSTIFY_RIGHT ?
+			l_space
+		: priv->line_justify == GTK_JUSTIFY_CENTER ?
+			l_space / 2
+		:
+			0;
+
+}
+
+
+/**
+
+    gnui_flow_model_get_page_shift:
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @extent:    The size occupied by all the rows along the perpendicular axis
+    @var_size:  The available size along the perpendicular axis
+
+    Compute how the rows are justified as a whole
+
+    Returns:    The logical offset of the first row along the perpendicular
+                axis
+
+**/
+static inline guint gnui_flow_model_get_page_shift (
+	const GnuiFlowLayoutPrivate * const priv,
+	const guint extent,
+	const guint var_size
+) {
+
+	return
+		extent >= var_size ?
+			0
+		: priv->page_justify == GTK_JUSTIFY_RIGHT ?
+			var_size - extent
+		: priv->page_justify == GTK_JUSTIFY_CENTER ?
+			(var_size - extent) / 2
+		:
+			0;
+
+}
+
+
+/**
+
+    gnui_flow_model_locate_item:
+    @fpriv:         (not nullable): Private `struct` of the `GnuiFlow`
+    @priv:          (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @row_idx:       The index of the row where to search
+    @index:         The index of the item to locate, or `G_MAXUINT` for
+                    locating the item at @fix_offset
+    @fix_offset:    The offset along the orientation axis (ignored if @index is
+                    not `G_MAXUINT`)
+    @dest:          (nullable) (out): A pointer for saving the rectangle
+                    occupied by the item
+
+    Locate an item of a row as it was (or would have been) allocated during the
+    last allocation, whether the item has a widget or not
+
+    Returns:    The index of the item located, or `-1` if no item matched
+
+**/
+static gint gnui_flow_model_locate_item (
+	const GnuiFlowPrivate * const fpriv,
+	const GnuiFlowLayoutPrivate * const priv,
+	const guint row_idx,
+	const guint index,
+	const gint fix_offset,
+	GtkAllocation * const dest
+) {
+
+	if (row_idx >= fpriv->rows->len) {
+
+		return -1;
+
+	}
+
+	const GnuiFlowModelRow * const row =
+		&g_array_index(fpriv->rows, GnuiFlowModelRow, row_idx);
+
+	const GnuiFlowIndexedRow * const irow =
+		&g_array_index(priv->indexed_rows, GnuiFlowIndexedRow, row_idx);
+
+	const GnuiFlowModelItem * item;
+	GnuiOrientableRequisition estimate;
+	GnuiOrientableAllocation nexta;
+	guint l_exp_quota, l_n_larger_exp_quota;
+
+	gint fix_axis = gnui_flow_model_begin_row(
+		priv,
+		row,
+		priv->indexed_fix_size,
+		&l_exp_quota,
+		&l_n_larger_exp_quota
+	);
+
+	gnui_flow_model_get_estimate(fpriv, &estimate);
+
+	for (
+		guint idx = row->first_item;
+			idx < row->first_item + row->n_items;
+		idx++
+	) {
+
+		item = &g_array_index(fpriv->items, GnuiFlowModelItem, idx);
+
+		nexta.fix_size =
+			(item->is_measured ? item->requisition : estimate).fix_size +
+			l_exp_quota + (
+				idx - row->first_item < l_n_larger_exp_quota ? 1 : 0
+			);
+
+		nexta.fix_axis =
+			priv->indexed_flags & GNUI_ORIENTABLE_POSITION_FLAG_L_RTL ?
+				(gint) priv->indexed_fix_size - fix_axis - nexta.fix_size
+			:
+				fix_axis;
+
+		fix_axis += nexta.fix_size + priv->spacing;
+
+		if (
+			index == G_MAXUINT ? (
+				fix_offset < nexta.fix_axis ||
+				fix_offset >= nexta.fix_axis + (gint) nexta.fix_size
+			) : index != idx
+		) {
+
+			continue;
+
+		}
+
+		if (!dest) {
+
+			return idx;
+
+		}
+
+		if (priv->indexed_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
+
+			dest->x = irow->var_axis;
+			dest->y = nexta.fix_axis;
+			dest->width = irow->var_size;
+			dest->height = nexta.fix_size;
+
+		} else {
+
+			dest->x = nexta.fix_axis;
+			dest->y = irow->var_axis;
+			dest->width = nexta.fix_size;
+			dest->height = irow->var_size;
+
+		}
+
+		return idx;
+
+	}
+
+	return -1;
+
+}
+
+
+/**
+
+    gnui_flow__on_adjustment_value_changed:
+    @adjustment:    (auto) (unused): The adjustment of the scrollable ancestor
+    @v_flow:        (auto) (not nullable): The flow widget passed as `gpointer`
+
+    Handler for the `GtkAdjustment::value-changed` signal of the scrollable
+    ancestor of a flow widget bound to a model
+
+**/
+static void gnui_flow__on_adjustment_value_changed (
+	GtkAdjustment * const adjustment G_GNUC_UNUSED,
+	const gpointer v_flow
+) {
+
+	gtk_widget_queue_allocate(GTK_WIDGET(v_flow));
+
+}
+
+
+/**
+
+    gnui_flow_model_get_visible_area:
+    @flow:      (not nullable): The flow widget
+    @fpriv:     (not nullable): Private `struct` of @flow
+    @dest:      (not nullable) (out): A pointer for saving the visible area in
+                @flow's coordinates
+
+    Compute which part of a flow widget is visible inside its nearest
+    scrollable ancestor and keep track of the ancestor's adjustments
+
+    Returns:    `true` if the visible area has been computed, `false` if the
+                flow widget is not inside a scrollable widget
+
+**/
+static bool gnui_flow_model_get_visible_area (
+	GtkWidget * const flow,
+	GnuiFlowPrivate * const fpriv,
+	graphene_rect_t * const dest
+) {
+
+	GtkWidget * const scrollable =
+		gtk_widget_get_ancestor(flow, GTK_TYPE_SCROLLABLE);
+
+	GtkAdjustment * adjustment;
+
+	for (guint8 idx = 0; idx < 2; idx++) {
+
+		adjustment =
+			!scrollable ?
+				NULL
+			: idx ?
+				gtk_scrollable_get_vadjustment(GTK_SCROLLABLE(scrollable))
+			:
+				gtk_scrollable_get_hadjustment(GTK_SCROLLABLE(scrollable));
+
+		if (adjustment == fpriv->adjustments[idx]) {
+
+			continue;
+
+		}
+
+		if (fpriv->adjustments[idx]) {
+
+			g_clear_signal_handler(
+				&fpriv->value_changed_handlers[idx],
+				fpriv->adjustments[idx]
+			);
+
+			g_object_unref(fpriv->adjustments[idx]);
+
+		}
+
+		if ((fpriv->adjustments[idx] = adjustment)) {
+
+			g_object_ref(adjustment);
+
+			fpriv->value_changed_handlers[idx] = g_signal_connect(
+				adjustment,
+				"value-changed",
+				G_CALLBACK(gnui_flow__on_adjustment_value_changed),
+				flow
+			);
+
+		}
+
+	}
+
+	return scrollable && gtk_widget_compute_bounds(scrollable, flow, dest);
+
+}
+
+
+/**
+
+    gnui_flow_model_measure:
+    @flow:      (not nullable): The flow widget
+    @fpriv:     (not nullable): Private `struct` of @flow
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @dimension: The dimension that is being queried
+    @space:     The available size along the orientation axis, or zero if
+                this is unknown or irrelevant
+
+    Measure a flow widget bound to a model
+
+    If no item has been measured yet (for instance before the first
+    allocation) one is measured here, so that the flow never requests less
+    than the estimated size of an item.
+
+    Returns:    The minimum and natural size of the flow widget
+
+**/
+static gint gnui_flow_model_measure (
+	GtkWidget * const flow,
+	GnuiFlowPrivate * const fpriv,
+	const GnuiFlowLayoutPrivate * const priv,
+	const GtkOrientation dimension,
+	const guint space
+) {
+
+	gnui_flow_model_ensure_estimate(flow, fpriv, priv);
+
+	if (dimension == priv->orientation) {
+
+		return (gint) fpriv->max_requisition.fix_size;
+
+	}
+
+	if (space == 0) {
+
+		return (gint) fpriv->max_requisition.var_size;
+
+	}
+
+	/*  Only the size of the last allocation is worth caching  */
+	return (gint) (
+		space == priv->allocated_fix_size ?
+			gnui_flow_model_ensure_rows(fpriv, priv, space)
+		:
+			gnui_flow_model_break_rows(fpriv, priv, space, 0, NULL)
+	);
+
+}
+
+
+/**
+
+    gnui_flow_model_allocate:
+    @manager:           (not nullable): The flow layout manager
+    @flow:              (not nullable): The flow widget
+    @fpriv:             (not nullable): Private `struct` of @flow
+    @available_width:   The available width
+    @available_height:  The available height
+
+    Allocate a flow widget bound to a model: only the rows that intersect the
+    visible area get widgets, the others are released for recycling
+
+**/
+static void gnui_flow_model_allocate (
+	GtkLayoutManager * const manager,
+	GtkWidget * const flow,
+	GnuiFlowPrivate * const fpriv,
+	const int available_width,
+	const int available_height
+) {
+
+	GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(GNUI_FLOW_LAYOUT(manager));
+
+	GtkAllocation child_allocation;
+	GnuiOrientableAllocation nexta;
+	GnuiOrientableRequisition space;
+	GnuiFlowChildLayoutPrivate * chinfo;
+	const GnuiFlowModelRow * row;
+	GnuiFlowIndexedRow * irow;
+	const GnuiFlowModelItem * item;
+	graphene_rect_t visible_area;
+	gint64 area_start, area_end, visible_start, visible_end;
+	guint extent, p_shift, l_exp_quota, l_n_larger_exp_quota,
+		first_row, end_row, start, end, idx;
+	guint8 n_attempts = 0;
+	bool sizes_changed, sizes_have_changed = false;
+	GnuiOrientablePositionFlags new_flags = 0;
+
+	if (priv->page_direction == GTK_TEXT_DIR_RTL) new_flags |=
+		GNUI_ORIENTABLE_POSITION_FLAG_P_RTL;
+	if (priv->line_direction == GTK_TEXT_DIR_RTL) new_flags |=
+		GNUI_ORIENTABLE_POSITION_FLAG_L_RTL;
+	if (priv->orientation == GTK_ORIENTATION_VERTICAL) new_flags |=
+		GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL;
+
+	if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
+
+		space.fix_size = available_height;
+		space.var_size = available_width;
+
+	} else {
+
+		space.fix_size = available_width;
+		space.var_size = available_height;
+
+	}
+
+	const bool everything_is_visible =
+		!gnui_flow_model_get_visible_area(flow, fpriv, &visible_area);
+
+	if (!fpriv->items->len) {
+
+		gnui_flow_model_release_all(fpriv);
+		g_array_set_size(priv->indexed_rows, 0);
+		g_array_set_size(priv->indexed_children, 0);
+		return;
+
+	}
+
+	if (gnui_flow_model_ensure_estimate(flow, fpriv, priv)) {
+
+		sizes_have_changed = true;
+
+	}
+
+
+	/* \                                  /\
+	\ */     find_visible_rows:          /* \
+	 \/     ________________________     \ */
+
+
+	extent = gnui_flow_model_ensure_rows(fpriv, priv, space.fix_size);
+	p_shift = gnui_flow_model_get_page_shift(priv, extent, space.var_size);
+
+	if (everything_is_visible) {
+
+		first_row = 0;
+		end_row = fpriv->rows->len;
+
+	} else {
+
+		if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
+
+			area_start = visible_area.origin.x;
+			area_end = area_start + visible_area.size.width;
+
+		} else {
+
+			area_start = visible_area.origin.y;
+			area_end = area_start + visible_area.size.height;
+
+		}
+
+		/*  Convert the visible area into rows' coordinates  */
+		if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_P_RTL) {
+
+			visible_start = MAX(extent, space.var_size) - p_shift - area_end;
+			visible_end = MAX(extent, space.var_size) - p_shift - area_start;
+
+		} else {
+
+			visible_start = area_start - p_shift;
+			visible_end = area_end - p_shift;
+
+		}
+
+		first_row = gnui_flow_model_find_row(fpriv, visible_start, true);
+		end_row = gnui_flow_model_find_row(fpriv, visible_end - 1, false);
+
+	}
+
+	if (first_row < end_row) {
+
+		row = &g_array_index(fpriv->rows, GnuiFlowModelRow, end_row - 1);
+
+		start =
+			g_array_index(fpriv->rows, GnuiFlowModelRow, first_row).first_item;
+
+		end = row->first_item + row->n_items;
+
+	} else {
+
+		start = end = 0;
+
+	}
+
+	for (idx = fpriv->bound_start; idx < fpriv->bound_end; idx++) {
+
+		if (idx < start || idx >= end) {
+
+			gnui_flow_model_release_item(
+				fpriv,
+				&g_array_index(fpriv->items, GnuiFlowModelItem, idx)
+			);
+
+		}
+
+	}
+
+	fpriv->bound_start = start;
+	fpriv->bound_end = end;
+	sizes_changed = false;
+
+	for (idx = start; idx < end; idx++) {
+
+		if (gnui_flow_model_bind_item(flow, fpriv, priv, idx)) {
+
+			sizes_changed = true;
+
+		}
+
+	}
+
+	if (sizes_changed) {
+
+		sizes_have_changed = true;
+
+		/*  Rows must be broken again, but do not chase estimates forever  */
+		if (++n_attempts < 3) {
+
+			goto find_visible_rows;
+
+		}
+
+		/*  The bound items no longer have the sizes with which the rows of
+			the last attempt were broken: re-flow the rows from the first
+			visible one with the sizes just measured and keep only the items
+			that still fall in them (the next allocation will fix what
+			remains)  */
+		if (first_row < end_row) {
+
+			/*  The rows stay marked as stale: the items measured have
+				changed the estimate of the rows above too  */
+			extent = gnui_flow_model_break_rows(
+				fpriv,
+				priv,
+				space.fix_size,
+				first_row,
+				fpriv->rows
+			);
+
+			fpriv->rows_are_indexed = false;
+
+			p_shift =
+				gnui_flow_model_get_page_shift(priv, extent, space.var_size);
+
+			for (end_row = first_row; end_row < fpriv->rows->len; end_row++) {
+
+				row = &g_array_index(fpriv->rows, GnuiFlowModelRow, end_row);
+
+				if (row->first_item >= end) {
+
+					break;
+
+				}
+
+			}
+
+		}
+
+	}
+
+	/*  ==> End of loop `find_visible_rows`  */
+
+	/*  All the rows are indexed, but the children are not (the items are
+		located on demand -- see `gnui_flow_model_locate_item()`); the index
+		of the rows is rebuilt only if the rows or their placement have
+		changed, so that scrolling touches only the rows that are visible  */
+	g_array_set_size(priv->indexed_children, 0);
+
+	if (
+		fpriv->rows_are_indexed &&
+		fpriv->indexed_p_shift == p_shift &&
+		fpriv->indexed_span == MAX(extent, space.var_size) &&
+		priv->indexed_flags == new_flags &&
+		priv->indexed_rows->len == fpriv->rows->len
+	) {
+
+		goto skip_indexing;
+
+	}
+
+	g_array_set_size(priv->indexed_rows, fpriv->rows->len);
+	fpriv->indexed_p_shift = p_shift;
+	fpriv->indexed_span = MAX(extent, space.var_size);
+	fpriv->rows_are_indexed = true;
+
+	for (guint row_idx = 0; row_idx < fpriv->rows->len; row_idx++) {
+
+		row = &g_array_index(fpriv->rows, GnuiFlowModelRow, row_idx);
+		irow = &g_array_index(priv->indexed_rows, GnuiFlowIndexedRow, row_idx);
+		irow->first_child = row->first_item;
+		irow->var_size = row->row_size;
+		irow->var_axis = row->var_axis + p_shift;
+
+		if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_P_RTL) {
+
+			irow->var_axis =
+				MAX(extent, space.var_size) - irow->var_axis - irow->var_size;
+
+		}
+
+	}
+
+	skip_indexing:
+
+	priv->indexed_fix_size = space.fix_size;
+	priv->indexed_flags = new_flags;
+	priv->last_pass.first = NULL;
+
+	for (guint row_idx = first_row; row_idx < end_row; row_idx++) {
+
+		row = &g_array_index(fpriv->rows, GnuiFlowModelRow, row_idx);
+		irow = &g_array_index(priv->indexed_rows, GnuiFlowIndexedRow, row_idx);
+
+		nexta.fix_axis = gnui_flow_model_begin_row(
+			priv,
+			row,
+			space.fix_size,
+			&l_exp_quota,
+			&l_n_larger_exp_quota
+		);
+
+		nexta.var_size = irow->var_size;
+		nexta.var_axis = irow->var_axis;
+
+		/*  After a re-flow the last row can end with items that are not
+			bound: these get allocated only by the next allocation  */
+		for (
+			idx = row->first_item;
+				idx < row->first_item + row->n_items && idx < end;
+			idx++
+		) {
+
+			item = &g_array_index(fpriv->items, GnuiFlowModelItem, idx);
+
+			nexta.fix_size =
+				item->requisition.fix_size + l_exp_quota + (
+					idx - row->first_item < l_n_larger_exp_quota ? 1 : 0
+				);
+
+			if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
+
+				child_allocation.width = nexta.var_size;
+				child_allocation.height = nexta.fix_size;
+				child_allocation.x = nexta.var_axis;
+
+				child_allocation.y =
+					new_flags & GNUI_ORIENTABLE_POSITION_FLAG_L_RTL ?
+						(gint) space.fix_size - nexta.fix_axis - nexta.fix_size
+					:
+						nexta.fix_axis;
+
+			} else {
+
+				child_allocation.width = nexta.fix_size;
+				child_allocation.height = nexta.var_size;
+
+				child_allocation.x =
+					new_flags & GNUI_ORIENTABLE_POSITION_FLAG_L_RTL ?
+						(gint) space.fix_size - nexta.fix_axis - nexta.fix_size
+					:
+						nexta.fix_axis;
+
+				child_allocation.y = nexta.var_axis;
+
+			}
+
+			nexta.fix_axis += nexta.fix_size + priv->spacing;
+
+			if (idx == row->first_item) new_flags |=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_L_START;
+			if (row_idx == 0) new_flags |=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_P_START;
+			if (idx + 1 == row->first_item + row->n_items) new_flags |=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_L_END;
+			if (row_idx + 1 == fpriv->rows->len) new_flags |=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_P_END;
+
+			chinfo = gnui_flow_child_layout_get_instance_private(
+				GNUI_FLOW_CHILD_LAYOUT(
+					gtk_layout_manager_get_layout_child(manager, item->widget)
+				)
+			);
+
+			chinfo->child = item->widget;
+
+			if (priv->positional_classes) {
+
+				gnui_flow_chinfo_update_style_classes(chinfo, new_flags);
+
+			}
+
+			gtk_widget_size_allocate(item->widget, &child_allocation, -1);
+
+			new_flags &=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL |
+				GNUI_ORIENTABLE_POSITION_FLAG_L_RTL |
+				GNUI_ORIENTABLE_POSITION_FLAG_P_RTL;
+
+		}
+
+	}
+
+	if (priv->allocated_fix_size != space.fix_size) {
+
+		priv->allocated_fix_size = space.fix_size;
+
+		if (priv->measured_fix_size != space.fix_size) {
+
+			sizes_have_changed = true;
+
+		}
+
+	}
+
+	if (sizes_have_changed) {
+
+		/*  Let the parent know the new extent of the rows  */
+		gtk_layout_manager_layout_changed(manager);
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow__on_model_items_changed:
+    @model:     (auto) (unused): The model bound to the flow widget
+    @position:  (auto): The position of the change
+    @removed:   (auto): The number of items removed
+    @added:     (auto): The number of items added
+    @v_flow:    (auto) (not nullable): The flow widget passed as `gpointer`
+
+    Handler for the `GListModel::items-changed` signal of the model bound to a
+    flow widget
+
+**/
+static void gnui_flow__on_model_items_changed (
+	GListModel * const model G_GNUC_UNUSED,
+	const guint position,
+	const guint removed,
+	const guint added,
+	const gpointer v_flow
+) {
+
+	GnuiFlowPrivate * const fpriv =
+		gnui_flow_get_instance_private(GNUI_FLOW(v_flow));
+
+	const GnuiFlowModelItem * item;
+	const guint old_len = fpriv->items->len;
+
+	if (position < fpriv->bound_end) {
+
+		/*  The indices of the bound items are about to shift  */
+		gnui_flow_model_release_all(fpriv);
+
+	}
+
+	/*  The rows that follow the change are stale until the next allocation
+		(the one that precedes it might now host more items)  */
+	g_array_set_size(
+		fpriv->rows,
+		gnui_flow_model_find_item_row(fpriv, position ? position - 1 : 0)
+	);
+
+	gnui_flow_model_invalidate_rows(fpriv, position);
+
+	if (position < fpriv->first_unmeasured) {
+
+		fpriv->first_unmeasured = position;
+
+	}
+
+	for (guint idx = position; idx < position + removed; idx++) {
+
+		item = &g_array_index(fpriv->items, GnuiFlowModelItem, idx);
+
+		if (item->is_measured) {
+
+			fpriv->n_measured--;
+			fpriv->measured_fix_sum -= item->requisition.fix_size;
+			fpriv->measured_var_sum -= item->requisition.var_size;
+
+		}
+
+	}
+
+	if (removed) {
+
+		g_array_remove_range(fpriv->items, position, removed);
+
+	}
+
+	if (added) {
+
+		g_array_set_size(fpriv->items, old_len - removed + added);
+
+		memmove(
+			&g_array_index(fpriv->items, GnuiFlowModelItem, position + added),
+			&g_array_index(fpriv->items, GnuiFlowModelItem, position),
+			(old_len - removed - position) * sizeof(GnuiFlowModelItem)
+		);
+
+		memset(
+			&g_array_index(fpriv->items, GnuiFlowModelItem, position),
+			0,
+			added * sizeof(GnuiFlowModelItem)
+		);
+
+	}
+
+	gtk_widget_queue_resize(GTK_WIDGET(v_flow));
+
+}
+
+
+/**
+
+    gnui_flow_model_unbind:
+    @self:      (not nullable): The flow widget
+
+    Unbind the model bound to a flow widget (if any) and destroy all the
+    widgets created for it
+
+**/
+static void gnui_flow_model_unbind (
+	GnuiFlow * const self
+) {
+
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
+
+	if (!fpriv->model) {
+
+		return;
+
+	}
+
+	g_clear_signal_handler(&fpriv->items_changed_handler, fpriv->model);
+	g_clear_object(&fpriv->model);
+
+	for (guint8 idx = 0; idx < 2; idx++) {
+
+		if (fpriv->adjustments[idx]) {
+
+			g_clear_signal_handler(
+				&fpriv->value_changed_handlers[idx],
+				fpriv->adjustments[idx]
+			);
+
+			g_clear_object(&fpriv->adjustments[idx]);
+
+		}
+
+	}
+
+	for (guint idx = fpriv->bound_start; idx < fpriv->bound_end; idx++) {
+
+		gtk_widget_unparent(
+			g_array_index(fpriv->items, GnuiFlowModelItem, idx).widget
+		);
+
+	}
+
+	for (guint idx = 0; idx < fpriv->pool->len; idx++) {
+
+		gtk_widget_unparent(g_ptr_array_index(fpriv->pool, idx));
+
+	}
+
+	g_array_unref(fpriv->items);
+	g_array_unref(fpriv->rows);
+	g_ptr_array_unref(fpriv->pool);
+
+	if (fpriv->user_data_free_func) {
+
+		fpriv->user_data_free_func(fpriv->user_data);
+
+	}
+
+	/*  Reset the model state only -- keep the freeze and the children index  */
+
+	*fpriv = (GnuiFlowPrivate) {
+		.children_index = fpriv->children_index,
+		.update_depth = fpriv->update_depth,
+		.frozen_sizes = {
+			{ fpriv->frozen_sizes[0][0], fpriv->frozen_sizes[0][1] },
+			{ fpriv->frozen_sizes[1][0], fpriv->frozen_sizes[1][1] }
+		},
+		.frozen_edges = { fpriv->frozen_edges[0], fpriv->frozen_edges[1] },
+		.has_new_children = fpriv->has_new_children
+	};
+
+}
+
+
+/*  Indexed children  */
+
+
+/**
+
+    gnui_flow_children_index_drop:
+    @fpriv:     (not nullable): The flow widget's private data
+
+    Forget the order-statistic index of the children of a flow widget
+
+**/
+static void gnui_flow_children_index_drop (
+	GnuiFlowPrivate * const fpriv
+) {
+
+	if (!fpriv->children_index) {
+
+		return;
+
+	}
+
+	GSequenceIter * iter;
+
+	for (
+		iter = g_sequence_get_begin_iter(fpriv->children_index);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) {
+
+		((GnuiFlowChildLayoutPrivate *) g_sequence_get(iter))->index_iter =
+			NULL;
+
+	}
+
+	g_sequence_free(fpriv->children_index);
+	fpriv->children_index = NULL;
+
+}
+
+
+/**
+
+    gnui_flow_children_index_ensure:
+    @self:      (not nullable): The flow widget
+    @fpriv:     (not nullable): The flow widget's private data
+
+    Build the order-statistic index of the children of a flow widget, if this
+    does not exist yet or if its first and last entries do not match the
+    first and last children anymore (O(1) when the index is valid)
+
+    Returns:    The index of the children
+
+**/
+static GSequence * gnui_flow_children_index_ensure (
+	GnuiFlow * const self,
+	GnuiFlowPrivate * const fpriv
+) {
+
+	GnuiFlowChildLayoutPrivate * chinfo;
+	GtkWidget * child;
+
+	if (fpriv->children_index) {
+
+		/*  Removed children leave the index by themselves and the children
+			added through us are placed in it, so only the edges are compared
+			here (what happens in the middle is caught by
+			`gnui_flow_children_index_check()` and by the next layout pass)  */
+
+		GSequenceIter * const last_iter = g_sequence_iter_prev(
+			g_sequence_get_end_iter(fpriv->children_index)
+		);
+
+		if (
+			g_sequence_iter_is_end(last_iter) ?
+				!gtk_widget_get_first_child(GTK_WIDGET(self))
+			:
+				((GnuiFlowChildLayoutPrivate *) g_sequence_get(
+					g_sequence_get_begin_iter(fpriv->children_index)
+				))->child == gtk_widget_get_first_child(GTK_WIDGET(self)) &&
+				((GnuiFlowChildLayoutPrivate *) g_sequence_get(
+					last_iter
+				))->child == gtk_widget_get_last_child(GTK_WIDGET(self))
+		) {
+
+			return fpriv->children_index;
+
+		}
+
+		/*  Children have been added without passing through us  */
+		gnui_flow_children_index_drop(fpriv);
+
+	}
+
+	GtkLayoutManager * const manager =
+		gtk_widget_get_layout_manager(GTK_WIDGET(self));
+
+	fpriv->children_index = g_sequence_new(NULL);
+
+	for (
+		child = gtk_widget_get_first_child(GTK_WIDGET(self));
+			child;
+		child = gtk_widget_get_next_sibling(child)
+	) {
+
+		chinfo = gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(manager, child)
+			)
+		);
+
+		chinfo->child = child;
+
+		chinfo->index_iter =
+			g_sequence_append(fpriv->children_index, chinfo);
+
+	}
+
+	return fpriv->children_index;
+
+}
+
+
+/**
+
+    gnui_flow_children_index_check:
+    @self:      (not nullable): The flow widget
+    @fpriv:     (not nullable): The flow widget's private data
+    @iter:      (not nullable): A position in the order-statistic index
+
+    Verify that the neighbours of a position in the order-statistic index are
+    still the siblings of the corresponding child (children moved directly
+    with `gtk_widget_insert_before()` and friends keep their position in the
+    index)
+
+    Returns:    `true` if the index agrees with the children list around
+                @iter, `false` otherwise (the index is then dropped)
+
+**/
+static bool gnui_flow_children_index_check (
+	GnuiFlow * const self,
+	GnuiFlowPrivate * const fpriv,
+	GSequenceIter * const iter
+) {
+
+	GSequenceIter * const prev_iter = g_sequence_iter_prev(iter);
+
+	GtkWidget * const prev_child =
+		prev_iter == iter ?
 			NULL
+		:
+			((GnuiFlowChildLayoutPrivate *) g_sequence_get(prev_iter))->child;
+
+	if (g_sequence_iter_is_end(iter)) {
+
+		if (prev_child == gtk_widget_get_last_child(GTK_WIDGET(self))) {
+
+			return true;
+
+		}
+
+		goto drop_and_exit;
+
+	}
+
+	GSequenceIter * const next_iter = g_sequence_iter_next(iter);
+	GtkWidget * const child =
+		((GnuiFlowChildLayoutPrivate *) g_sequence_get(iter))->child;
+
+	if (
+		gtk_widget_get_parent(child) == GTK_WIDGET(self) &&
+		gtk_widget_get_prev_sibling(child) == prev_child &&
+		gtk_widget_get_next_sibling(child) == (
+			g_sequence_iter_is_end(next_iter) ?
+				NULL
+			:
+				((GnuiFlowChildLayoutPrivate *)
+					g_sequence_get(next_iter))->child
+		)
+	) {
+
+		return true;
+
+	}
+
+	/*  The index does not reflect the order of the children anymore  */
+
+	drop_and_exit:
+
+	gnui_flow_children_index_drop(fpriv);
+	return false;
+
+}
+
+
+/**
+
+    gnui_flow_children_index_iter_of:
+    @self:      (not nullable): The flow widget
+    @fpriv:     (not nullable): The flow widget's private data
+    @child:     (nullable): A child of the flow widget, or `NULL` for the end
+                of the flow
+
+    Find a child in the order-statistic index (the index must exist)
+
+    Returns:    The position of @child in the index, or `NULL` if @child has
+                not been indexed (the index is then dropped)
+
+**/
+static GSequenceIter * gnui_flow_children_index_iter_of (
+	GnuiFlow * const self,
+	GnuiFlowPrivate * const fpriv,
+	GtkWidget * const child
+) {
+
+	if (!child) {
+
+		return g_sequence_get_end_iter(fpriv->children_index);
+
+	}
+
+	GSequenceIter * const iter = (
+		(GnuiFlowChildLayoutPrivate *)
+			gnui_flow_child_layout_get_instance_private(
+				GNUI_FLOW_CHILD_LAYOUT(
+					gtk_layout_manager_get_layout_child(
+						gtk_widget_get_layout_manager(GTK_WIDGET(self)),
+						child
+					)
+				)
+			)
+	)->index_iter;
+
+	if (!iter) {
+
+		/*  The child has been added without passing through us  */
+		gnui_flow_children_index_drop(fpriv);
+
+	}
+
+	return iter;
+
+}
+
+
+/**
+
+    gnui_flow_children_index_iter_after:
+    @self:      (not nullable): The flow widget
+    @fpriv:     (not nullable): The flow widget's private data
+    @child:     (nullable): A child of the flow widget, or `NULL` for the
+                beginning of the flow
+
+    Find the position that follows a child in the order-statistic index (the
+    index must exist)
+
+    Returns:    The position that follows @child in the index, or `NULL` if
+                @child has not been indexed (the index is then dropped)
+
+**/
+static GSequenceIter * gnui_flow_children_index_iter_after (
+	GnuiFlow * const self,
+	GnuiFlowPrivate * const fpriv,
+	GtkWidget * const child
+) {
+
+	if (!child) {
+
+		return g_sequence_get_begin_iter(fpriv->children_index);
+
+	}
+
+	GSequenceIter * const iter =
+		gnui_flow_children_index_iter_of(self, fpriv, child);
+
+	return iter ? g_sequence_iter_next(iter) : NULL;
+
+}
+
+
+/**
+
+    gnui_flow_children_index_place:
+    @self:      (not nullable): The flow widget
+    @fpriv:     (not nullable): The flow widget's private data
+    @widget:    (not nullable): The widget that has just been inserted in the
+                flow widget
+    @before:    (nullable): The position in the index before which @widget
+                has been inserted, or `NULL` if the index must be dropped
+
+    Update the order-statistic index after a child has been inserted or moved
+    (and let a flow that is being updated know that it might have new children
+    to hide)
+
+**/
+static void gnui_flow_children_index_place (
+	GnuiFlow * const self,
+	GnuiFlowPrivate * const fpriv,
+	GtkWidget * const widget,
+	GSequenceIter * const before
+) {
+
+	fpriv->has_new_children = true;
+
+	if (!fpriv->children_index) {
+
+		return;
+
+	}
+
+	if (!before || gtk_widget_get_parent(widget) != GTK_WIDGET(self)) {
+
+		gnui_flow_children_index_drop(fpriv);
+		return;
+
+	}
+
+	GnuiFlowChildLayoutPrivate * const chinfo =
+		gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(
+					gtk_widget_get_layout_manager(GTK_WIDGET(self)),
+					widget
+				)
+			)
+		);
+
+	chinfo->child = widget;
+
+	if (!chinfo->index_iter) {
+
+		chinfo->index_iter = g_sequence_insert_before(before, chinfo);
+
+	} else if (chinfo->index_iter != before) {
+
+		g_sequence_move(chinfo->index_iter, before);
+
+	}
+
+}
+
+
+
+/*  GnuiFlowLayout and GnuiFlowChildLayout  */
+
+
+/**
+
+    gnui_flow_layout_invalidate_requisitions:
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+
+    Invalidate the cached size requests of all the children
+
+**/
+static inline void gnui_flow_layout_invalidate_requisitions (
+	GnuiFlowLayoutPrivate * const priv
+) {
+
+	/*  Zero is the serial of newly created children: skip it  */
+	if (!++priv->measure_serial) {
+
+		priv->measure_serial++;
+
+	}
+
+	/*  Forget the sizes asked so far  */
+	for (guint idx = 0; idx < 2; idx++) {
+
+		priv->asked_sizes[idx].length = 0;
+		priv->asked_sizes[idx].next = 0;
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow_layout_note_measure:
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @dimension: The dimension being measured
+    @for_size:  The size in the other dimension (or `-1`)
+
+    Remember a measurement requested by GTK, and invalidate the cached size
+    requests of all the children if the same measurement had already been
+    requested
+
+    GTK keeps its own cache of the sizes of each widget and asks us again only
+    for sizes that it has never seen, unless one of our descendants has queued
+    a resize in the meanwhile (this is what happens when children are added,
+    removed, shown, hidden or restyled, or when they change their content, as
+    well as when `gtk_layout_manager_layout_changed()` is invoked); a simple
+    resize therefore never invalidates what has been measured before.
+
+**/
+static inline void gnui_flow_layout_note_measure (
+	GnuiFlowLayoutPrivate * const priv,
+	const GtkOrientation dimension,
+	const gint for_size
+) {
+
+	GnuiFlowAskedSizes * const asked = priv->asked_sizes + dimension;
+
+	for (guint idx = 0; idx < asked->length; idx++) {
+
+		if (asked->for_sizes[idx] == for_size) {
+
+			/*  GTK has forgotten this size: something has changed  */
+			gnui_flow_layout_invalidate_requisitions(priv);
+			break;
+
+		}
+
+	}
+
+	asked->for_sizes[asked->next] = for_size;
+	asked->next = (asked->next + 1) % GNUI_FLOW_ASKED_SIZES;
+
+	if (asked->length < GNUI_FLOW_ASKED_SIZES) {
+
+		asked->length++;
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow_layout_update_orientation:
+    @manager:       (not nullable): The flow layout manager
+    @widget:        (not nullable): The widget currently adopting the flow
+                    layout manager
+    @orientation:   The flow layout manager's orientation
+
+    Update the flow layout manager's orientation
+
+**/
+static void gnui_flow_layout_update_orientation (
+	GnuiFlowLayout * const manager,
+	GtkWidget * const widget,
+	const GtkOrientation orientation
+) {
+
+	GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(manager);
+
+	if (priv->orientation == orientation) {
+
+		return;
+
+	}
+
+	priv->orientation = orientation;
+	priv->allocated_fix_size = 0;
+	priv->measured_fix_size = 0;
+	priv->last_pass.first = NULL;
+	gnui_flow_layout_invalidate_requisitions(priv);
+
+	if (orientation == GTK_ORIENTATION_VERTICAL) {
+
+		gtk_widget_add_css_class(widget, "vertical");
+		gtk_widget_remove_css_class(widget, "horizontal");
+
+	} else {
+
+		gtk_widget_add_css_class(widget, "horizontal");
+		gtk_widget_remove_css_class(widget, "vertical");
+	}
+
+	gtk_accessible_update_property(
+		GTK_ACCESSIBLE(widget),
+		GTK_ACCESSIBLE_PROPERTY_ORIENTATION,
+		orientation,
+		-1
+	);
+
+	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(manager));
+	g_object_notify(G_OBJECT(manager), "orientation");
+
+}
+
+
+/**
+
+    gnui_flow_layout_update_positional_classes:
+    @manager:       (not nullable): The flow layout manager
+    @widget:        (nullable): The widget currently adopting the flow layout
+                    manager
+    @enabled:       Whether the children must have positional CSS classes
+
+    Enable or disable the children's positional CSS classes
+
+**/
+static void gnui_flow_layout_update_positional_classes (
+	GnuiFlowLayout * const manager,
+	GtkWidget * const widget,
+	const bool enabled
+) {
+
+	GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(manager);
+
+	if (priv->positional_classes == enabled) {
+
+		return;
+
+	}
+
+	priv->positional_classes = enabled;
+
+	if (!enabled && widget) {
+
+		GnuiFlowChildLayoutPrivate * chinfo;
+		GtkWidget * child;
+
+		for (
+			child = gtk_widget_get_first_child(widget);
+				child;
+			child = gtk_widget_get_next_sibling(child)
+		) {
+
+			chinfo = gnui_flow_child_layout_get_instance_private(
+				GNUI_FLOW_CHILD_LAYOUT(
+					gtk_layout_manager_get_layout_child(
+						GTK_LAYOUT_MANAGER(manager),
+						child
+					)
+				)
+			);
+
+			chinfo->child = child;
+
+			gnui_flow_chinfo_update_style_classes(
+				chinfo,
+				GNUI_ORIENTABLE_POSITION_FLAG_NONE
+			);
+
+		}
+
+	} else if (enabled) {
+
+		/*  The classes will be restored by the next full allocation  */
+		priv->last_pass.first = NULL;
+		gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(manager));
+
+	}
+
+	g_object_notify_by_pspec(
+		G_OBJECT(manager),
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_POSITIONAL_CLASSES]
+	);
+
+}
+
+
+/**
+
+    gnui_flow_layout_hide_unplaced_children:
+    @manager:   (not nullable): The flow layout manager
+    @widget:    (not nullable): The widget currently adopting the flow layout
+                manager
+
+    Hide the children that have never been placed, until the next real
+    allocation
+
+**/
+static void gnui_flow_layout_hide_unplaced_children (
+	GtkLayoutManager * const manager,
+	GtkWidget * const widget
+) {
+
+	GnuiFlowChildLayoutPrivate * chinfo;
+	GtkWidget * child;
+
+	for (
+		child = gtk_widget_get_first_child(widget);
+			child;
+		child = gtk_widget_get_next_sibling(child)
+	) {
+
+		chinfo = gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(manager, child)
+			)
+		);
+
+		if (!chinfo->is_placed && !chinfo->is_frozen_out) {
+
+			gtk_widget_set_child_visible(child, false);
+			chinfo->is_frozen_out = true;
+
+		}
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow_layout_get_space:
+    @priv:              (not nullable): Private `struct` of the
+                        `GnuiFlowLayout`
+    @available_width:   The available width
+    @available_height:  The available height
+    @space:             (not nullable) (out): The available space, in
+                        orientable terms
+
+    Translate the space available to a flow in orientable terms
+
+    Returns:    The orientation and direction flags of the flow
+
+**/
+static GnuiOrientablePositionFlags gnui_flow_layout_get_space (
+	const GnuiFlowLayoutPrivate * const priv,
+	const int available_width,
+	const int available_height,
+	GnuiOrientableRequisition * const space
+) {
+
+	GnuiOrientablePositionFlags flags = GNUI_ORIENTABLE_POSITION_FLAG_NONE;
+
+	if (priv->page_direction == GTK_TEXT_DIR_RTL) flags |=
+		GNUI_ORIENTABLE_POSITION_FLAG_P_RTL;
+	if (priv->line_direction == GTK_TEXT_DIR_RTL) flags |=
+		GNUI_ORIENTABLE_POSITION_FLAG_L_RTL;
+
+	if (priv->orientation == GTK_ORIENTATION_VERTICAL) {
+
+		flags |= GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL;
+		space->fix_size = available_height;
+		space->var_size = available_width;
+
+	} else {
+
+		space->fix_size = available_width;
+		space->var_size = available_height;
+
+	}
+
+	return flags;
+
+}
+
+
+/**
+
+    gnui_flow_layout_conclude_allocation:
+    @manager:   (not nullable): The flow layout manager
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @fix_size:  The size allocated along the orientation axis
+
+    Remember the size of an allocation and request a second pass if the
+    parent has not measured us for it
+
+**/
+static void gnui_flow_layout_conclude_allocation (
+	GtkLayoutManager * const manager,
+	GnuiFlowLayoutPrivate * const priv,
+	const guint fix_size
+) {
+
+	if (priv->allocated_fix_size != fix_size) {
+
+		priv->allocated_fix_size = fix_size;
+
+		/*  A parent that supports height-for-width has already measured us
+			for this size; the others need a second pass that uses the size
+			just allocated  */
+		if (priv->measured_fix_size != fix_size) {
+
+			gtk_layout_manager_layout_changed(manager);
+
+		}
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow_layout_fit_lanes:
+    @priv:          (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @fix_size:      The space available along the orientation axis
+    @n_children:    The number of children to place (greater than zero)
+    @lane_size:     (not nullable) (inout): The size of a lane along the
+                    orientation axis, possibly enlarged by
+                    `GTK_JUSTIFY_FILL`
+    @lane_step:     (not nullable) (out): The distance between the beginnings
+                    of two adjacent lanes
+    @l_offset:      (not nullable) (out): The offset of the first lane
+
+    Compute how many lanes of equal size the space can host, and where they
+    go according to the line justification
+
+    Returns:    The number of lanes (never more than @n_children)
+
+**/
+static guint gnui_flow_layout_fit_lanes (
+	const GnuiFlowLayoutPrivate * const priv,
+	const guint fix_size,
+	const guint n_children,
+	guint * const lane_size,
+	gint * const lane_step,
+	gint * const l_offset
+) {
+
+	*lane_step = (gint) *lane_size + priv->spacing;
+
+	guint n_lanes =
+		*lane_step > 0 && (gint) fix_size + priv->spacing > *lane_step ?
+			((gint) fix_size + priv->spacing) / *lane_step
+		:
+			1;
+
+	if (n_lanes > n_children) {
+
+		n_lanes = n_children;
+
+	}
+
+	const gint used = (gint) n_lanes * *lane_step - priv->spacing;
+	const guint l_space = (gint) fix_size > used ? fix_size - used : 0;
+
+	*l_offset = 0;
+
+	switch (priv->line_justify) {
+
+		case GTK_JUSTIFY_FILL:
+
+			*lane_size += l_space / n_lanes;
+			*lane_step += l_space / n_lanes;
+			break;
+
+		case GTK_JUSTIFY_RIGHT:
+
+			*l_offset = l_space;
+			break;
+
+		case GTK_JUSTIFY_CENTER:
+
+			*l_offset = l_space / 2;
+			break;
+
+		default:
+
+			break;
+
+	}
+
+	return n_lanes;
+
+}
+
+
+/**
+
+    gnui_flow_layout_pack_masonry:
+    @manager:   (not nullable): The flow layout manager
+    @widget:    (not nullable): The widget currently adopting the flow layout
+                manager
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @space:     (not nullable): The space available (only the size along the
+                orientation axis is used when measuring)
+    @flags:     The orientation and direction flags of the flow
+    @allocate:  Whether the children must be allocated or only measured
+
+    Pack the children of a flow in lanes as large as the largest child,
+    placing each child in the currently shortest lane
+
+    Returns:    The size occupied perpendicularly to the orientation axis
+
+**/
+static guint gnui_flow_layout_pack_masonry (
+	GtkLayoutManager * const manager,
+	GtkWidget * const widget,
+	GnuiFlowLayoutPrivate * const priv,
+	const GnuiOrientableRequisition * const space,
+	const GnuiOrientablePositionFlags flags,
+	const bool allocate
+) {
+
+	GnuiFlowChildLayoutPrivate * chinfo;
+	GtkWidget * child;
+	guint n_children = 0, lane_size = 0;
+
+	for (
+		child = gtk_widget_get_first_child(widget);
+			child;
+		child = gtk_widget_get_next_sibling(child)
+	) {
+
+		if (!gtk_widget_should_layout(child)) {
+
+			continue;
+
+		}
+
+		chinfo = gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(manager, child)
+			)
+		);
+
+		gnui_flow_chinfo_ensure_requisition(chinfo, child, priv);
+		GNUI_SET_IF_GREATER__2_2(lane_size, chinfo->requisition.fix_size);
+		n_children++;
+
+	}
+
+	if (allocate) {
+
+		g_array_set_size(priv->indexed_rows, 0);
+		g_array_set_size(priv->indexed_children, 0);
+		priv->indexed_fix_size = space->fix_size;
+		priv->indexed_flags = flags;
+
+	}
+
+	if (!n_children) {
+
+		return 0;
+
+	}
+
+	gint lane_step, l_offset;
+
+	const guint n_lanes = gnui_flow_layout_fit_lanes(
+		priv,
+		space->fix_size,
+		n_children,
+		&lane_size,
+		&lane_step,
+		&l_offset
+	);
+
+	GnuiFlowLane * const lanes = g_new0(GnuiFlowLane, n_lanes);
+	GnuiOrientableAllocation nexta;
+	GtkAllocation child_allocation;
+	GnuiOrientablePositionFlags child_flags;
+	guint lane_idx, shortest, occupied = 0;
+
+	for (
+		child = gtk_widget_get_first_child(widget);
+			child;
+		child = gtk_widget_get_next_sibling(child)
+	) {
+
+		if (!gtk_widget_should_layout(child)) {
+
+			continue;
+
+		}
+
+		chinfo = gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(manager, child)
+			)
+		);
+
+		for (shortest = 0, lane_idx = 1; lane_idx < n_lanes; lane_idx++) {
+
+			if (lanes[lane_idx].var_size < lanes[shortest].var_size) {
+
+				shortest = lane_idx;
+
+			}
+
+		}
+
+		nexta.fix_axis = l_offset + (gint) shortest * lane_step;
+		nexta.fix_size = lane_size;
+
+		nexta.var_axis =
+			lanes[shortest].last ?
+				(gint) lanes[shortest].var_size + priv->leading
+			:
+				0;
+
+		nexta.var_size = chinfo->requisition.var_size;
+		lanes[shortest].var_size = nexta.var_axis + nexta.var_size;
+		GNUI_SET_IF_GREATER__2_2(occupied, lanes[shortest].var_size);
+
+		if (!allocate) {
+
+			lanes[shortest].last = chinfo;
+			continue;
+
+		}
+
+		if (flags & GNUI_ORIENTABLE_POSITION_FLAG_L_RTL) {
+
+			nexta.fix_axis = space->fix_size - nexta.fix_axis - nexta.fix_size;
+
+		}
+
+		if (flags & GNUI_ORIENTABLE_POSITION_FLAG_P_RTL) {
+
+			nexta.var_axis = space->var_size - nexta.var_axis - nexta.var_size;
+
+		}
+
+		if (flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
+
+			child_allocation.width = nexta.var_size;
+			child_allocation.height = nexta.fix_size;
+			child_allocation.x = nexta.var_axis;
+			child_allocation.y = nexta.fix_axis;
+
+		} else {
+
+			child_allocation.width = nexta.fix_size;
+			child_allocation.height = nexta.var_size;
+			child_allocation.x = nexta.fix_axis;
+			child_allocation.y = nexta.var_axis;
+
+		}
+
+		child_flags = flags;
+
+		if (shortest == 0) child_flags |=
+			GNUI_ORIENTABLE_POSITION_FLAG_IS_L_START;
+		if (shortest == n_lanes - 1) child_flags |=
+			GNUI_ORIENTABLE_POSITION_FLAG_IS_L_END;
+
+		if (!lanes[shortest].last) {
+
+			child_flags |= GNUI_ORIENTABLE_POSITION_FLAG_IS_P_START;
+
+		} else if (priv->positional_classes) {
+
+			/*  The previous child of this lane is not the last one  */
+			gnui_flow_chinfo_update_style_classes(
+				lanes[shortest].last,
+				lanes[shortest].last_flags
+			);
+
+		}
+
+		lanes[shortest].last = chinfo;
+		lanes[shortest].last_flags = child_flags;
+		chinfo->child = child;
+
+		chinfo->indexed_slot = priv->indexed_children->len;
+
+		g_array_append_vals(
+			priv->indexed_children,
+			&(GnuiFlowIndexedChild) {
+				.allocation = child_allocation,
+				.child = child
+			},
+			1
+		);
+
+		gnui_flow_chinfo_mark_placed(chinfo, child);
+		gtk_widget_size_allocate(child, &child_allocation, -1);
+
+	}
+
+	if (allocate && priv->positional_classes) {
+
+		for (lane_idx = 0; lane_idx < n_lanes; lane_idx++) {
+
+			if (lanes[lane_idx].last) {
+
+				gnui_flow_chinfo_update_style_classes(
+					lanes[lane_idx].last,
+					lanes[lane_idx].last_flags |
+						GNUI_ORIENTABLE_POSITION_FLAG_IS_P_END
+				);
+
+			}
+
+		}
+
+	}
+
+	g_free(lanes);
+	return occupied;
+
+}
+
+
+/**
+
+    gnui_flow_layout_measure_cell:
+    @manager:   (not nullable): The flow layout manager
+    @widget:    (not nullable): The widget currently adopting the flow layout
+                manager
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @cell:      (not nullable) (out): The size of a cell
+
+    Measure the cells of a homogeneous flow, using only the first
+    `GNUI_FLOW_HOMOGENEOUS_SAMPLE` children that need a layout
+
+    Returns:    The number of children that need a layout
+
+**/
+static guint gnui_flow_layout_measure_cell (
+	GtkLayoutManager * const manager,
+	GtkWidget * const widget,
+	GnuiFlowLayoutPrivate * const priv,
+	GnuiOrientableRequisition * const cell
+) {
+
+	GnuiFlowChildLayoutPrivate * chinfo;
+	GtkWidget * child;
+	guint n_children = 0;
+
+	*cell = (GnuiOrientableRequisition) { 0 };
+
+	for (
+		child = gtk_widget_get_first_child(widget);
+			child;
+		child = gtk_widget_get_next_sibling(child)
+	) {
+
+		if (!gtk_widget_should_layout(child)) {
+
+			continue;
+
+		}
+
+		if (n_children++ >= GNUI_FLOW_HOMOGENEOUS_SAMPLE) {
+
+			continue;
+
+		}
+
+		chinfo = gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(manager, child)
+			)
+		);
+
+		gnui_flow_chinfo_ensure_requisition(chinfo, child, priv);
+		GNUI_SET_IF_GREATER__2_2(cell->fix_size, chinfo->requisition.fix_size);
+		GNUI_SET_IF_GREATER__2_2(cell->var_size, chinfo->requisition.var_size);
+
+	}
+
+	return n_children;
+
+}
+
+
+/**
+
+    gnui_flow_layout_allocate_homogeneous:
+    @manager:           (not nullable): The flow layout manager
+    @widget:            (not nullable): The widget currently adopting the flow
+                        layout manager
+    @priv:              (not nullable): Private `struct` of the
+                        `GnuiFlowLayout`
+    @available_width:   The available width
+    @available_height:  The available height
+
+    Allocate the children of a homogeneous flow, where every child gets a cell
+    of the same size and the position of each cell is computed directly from
+    the child's index
+
+**/
+static void gnui_flow_layout_allocate_homogeneous (
+	GtkLayoutManager * const manager,
+	GtkWidget * const widget,
+	GnuiFlowLayoutPrivate * const priv,
+	const int available_width,
+	const int available_height
+) {
+
+	GnuiOrientableRequisition space, cell;
+
+	const GnuiOrientablePositionFlags flags = gnui_flow_layout_get_space(
+		priv,
+		available_width,
+		available_height,
+		&space
+	);
+
+	const guint n_children =
+		gnui_flow_layout_measure_cell(manager, widget, priv, &cell);
+
+	g_array_set_size(priv->indexed_rows, 0);
+	g_array_set_size(priv->indexed_children, 0);
+	priv->indexed_fix_size = space.fix_size;
+	priv->indexed_flags = flags;
+	priv->last_pass.first = NULL;
+
+	if (!n_children) {
+
+		gnui_flow_layout_conclude_allocation(manager, priv, space.fix_size);
+		return;
+
+	}
+
+	GnuiFlowChildLayoutPrivate * chinfo;
+	GnuiOrientableAllocation nexta;
+	GtkAllocation child_allocation;
+	GnuiOrientablePositionFlags child_flags;
+	GtkWidget * child;
+	gint col_step, l_offset;
+	guint col, row, idx = 0;
+
+	const guint
+		n_cols = gnui_flow_layout_fit_lanes(
+			priv,
+			space.fix_size,
+			n_children,
+			&cell.fix_size,
+			&col_step,
+			&l_offset
+		),
+		n_rows = (n_children + n_cols - 1) / n_cols;
+
+	for (
+		child = gtk_widget_get_first_child(widget);
+			child;
+		child = gtk_widget_get_next_sibling(child)
+	) {
+
+		if (!gtk_widget_should_layout(child)) {
+
+			continue;
+
+		}
+
+		chinfo = gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(manager, child)
+			)
+		);
+
+		col = idx % n_cols;
+		row = idx / n_cols;
+
+		nexta = (GnuiOrientableAllocation) {
+			.fix_axis = l_offset + (gint) col * col_step,
+			.fix_size = cell.fix_size,
+			.var_axis = (gint) row * ((gint) cell.var_size + priv->leading),
+			.var_size = cell.var_size
+		};
+
+		if (flags & GNUI_ORIENTABLE_POSITION_FLAG_L_RTL) {
+
+			nexta.fix_axis = space.fix_size - nexta.fix_axis - nexta.fix_size;
+
+		}
+
+		if (flags & GNUI_ORIENTABLE_POSITION_FLAG_P_RTL) {
+
+			nexta.var_axis = space.var_size - nexta.var_axis - nexta.var_size;
+
+		}
+
+		if (flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
+
+			child_allocation.width = nexta.var_size;
+			child_allocation.height = nexta.fix_size;
+			child_allocation.x = nexta.var_axis;
+			child_allocation.y = nexta.fix_axis;
+
+		} else {
+
+			child_allocation.width = nexta.fix_size;
+			child_allocation.height = nexta.var_size;
+			child_allocation.x = nexta.fix_axis;
+			child_allocation.y = nexta.var_axis;
+
+		}
+
+		child_flags = flags;
+
+		if (col == 0) {
+
+			child_flags |= GNUI_ORIENTABLE_POSITION_FLAG_IS_L_START;
+
+			g_array_append_vals(
+				priv->indexed_rows,
+				&(GnuiFlowIndexedRow) {
+					.var_axis = nexta.var_axis,
+					.var_size = nexta.var_size,
+					.first_child = idx
+				},
+				1
+			);
+
+		}
+
+		if (col + 1 == n_cols || idx + 1 == n_children) child_flags |=
+			GNUI_ORIENTABLE_POSITION_FLAG_IS_L_END;
+		if (row == 0) child_flags |=
+			GNUI_ORIENTABLE_POSITION_FLAG_IS_P_START;
+		if (row + 1 == n_rows) child_flags |=
+			GNUI_ORIENTABLE_POSITION_FLAG_IS_P_END;
+
+		chinfo->child = child;
+		chinfo->indexed_slot = priv->indexed_children->len;
+
+		g_array_append_vals(
+			priv->indexed_children,
+			&(GnuiFlowIndexedChild) {
+				.allocation = child_allocation,
+				.child = child
+			},
+			1
+		);
+
+		if (priv->positional_classes) {
+
+			gnui_flow_chinfo_update_style_classes(chinfo, child_flags);
+
+		}
+
+		gnui_flow_chinfo_mark_placed(chinfo, child);
+		gtk_widget_size_allocate(child, &child_allocation, -1);
+		idx++;
+
+	}
+
+	gnui_flow_layout_conclude_allocation(manager, priv, space.fix_size);
+
+}
+
+
+/**
+
+    gnui_flow_breakpoints_get_slack:
+    @points:    (not nullable): The breakpoints of the flow
+    @start:     The breakpoint where the line starts
+    @end:       The breakpoint where the line ends
+    @fix_size:  The space available along the orientation axis
+    @spacing:   The spacing between the children
+
+    Compute the space left by a line of the balanced line breaker
+
+    Returns:    The space left, negative if the line overflows
+
+**/
+static inline gint64 gnui_flow_breakpoints_get_slack (
+	const GnuiFlowBreakpoint * const points,
+	const guint start,
+	const guint end,
+	const guint fix_size,
+	const guint spacing
+) {
+
+	return
+		(gint64) fix_size -
+		(gint64) (points[end].offset - points[start].offset) -
+		(gint64) (end - start - 1) * spacing;
+
+}
+
+
+/**
+
+    gnui_flow_layout_break_balanced:
+    @manager:   (not nullable): The flow layout manager
+    @widget:    (not nullable): The widget currently adopting the flow layout
+                manager
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @fix_size:  The space available along the orientation axis
+
+    Decide where the rows of a flow must break so that the sum of the squares
+    of the space left by each row (the last one excluded) is minimal
+
+    This is the minimum raggedness variant of Knuth-Plass; for each breakpoint
+    only the `GNUI_FLOW_BALANCED_WINDOW` shortest candidate lines and the
+    longest line that fits are weighed, so that the cost stays linear in the
+    number of children without limiting how many children a row can host. The
+    result is saved in the `breaks_before` field of each child.
+
+**/
+static void gnui_flow_layout_break_balanced (
+	GtkLayoutManager * const manager,
+	GtkWidget * const widget,
+	GnuiFlowLayoutPrivate * const priv,
+	const guint fix_size
+) {
+
+	GnuiFlowChildLayoutPrivate * chinfo;
+	GnuiFlowBreakpoint * point;
+	GtkWidget * child;
+	guint64 offset = 0;
+
+	g_array_set_size(priv->breakpoints, 0);
+
+	for (
+		child = gtk_widget_get_first_child(widget);
+			child;
+		child = gtk_widget_get_next_sibling(child)
+	) {
+
+		if (!gtk_widget_should_layout(child)) {
+
+			continue;
+
+		}
+
+		chinfo = gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(manager, child)
+			)
+		);
+
+		gnui_flow_chinfo_ensure_requisition(chinfo, child, priv);
+		chinfo->breaks_before = false;
+
+		g_array_append_vals(
+			priv->breakpoints,
+			&(GnuiFlowBreakpoint) {
+				.offset = offset,
+				.chinfo = chinfo
+			},
+			1
+		);
+
+		offset += chinfo->requisition.fix_size;
+
+	}
+
+	/*  The end of the flow is a breakpoint too  */
+	g_array_append_vals(
+		priv->breakpoints,
+		&(GnuiFlowBreakpoint) { .offset = offset },
+		1
+	);
+
+	GnuiFlowBreakpoint * const points =
+		(GnuiFlowBreakpoint *) priv->breakpoints->data;
+
+	const guint n_points = priv->breakpoints->len;
+	guint64 line_cost, cost;
+	gint64 slack;
+	guint first_fit = 0;
+
+	for (guint end = 1; end < n_points; end++) {
+
+		point = points + end;
+		point->cost = G_MAXUINT64;
+
+		/*  Where the longest line that ends here and still fits begins  */
+		while (
+			first_fit + 1 < end && gnui_flow_breakpoints_get_slack(
+				points,
+				first_fit,
+				end,
+				fix_size,
+				priv->spacing
+			) < 0
+		) {
+
+			first_fit++;
+
+		}
+
+		for (guint start = end - 1; ; start--) {
+
+			/*  Beyond the window only the longest line is weighed  */
+			if (start + GNUI_FLOW_BALANCED_WINDOW < end && start > first_fit) {
+
+				start = first_fit;
+
+			}
+
+			slack = gnui_flow_breakpoints_get_slack(
+				points,
+				start,
+				end,
+				fix_size,
+				priv->spacing
+			);
+
+			if (slack < 0) {
+
+				/*  A child larger than the flow gets a row of its own  */
+				if (start + 1 < end) {
+
+					break;
+
+				}
+
+				slack = 0;
+
+			}
+
+			/*  The last row can be as ragged as it likes  */
+			line_cost = end + 1 < n_points ? (guint64) slack * slack : 0;
+			cost = points[start].cost + line_cost;
+
+			if (cost < point->cost) {
+
+				point->cost = cost;
+				point->from = start;
+
+			}
+
+			if (start == 0) {
+
+				break;
+
+			}
+
+		}
+
+	}
+
+	/*  Walk the optimal path backwards, marking where each row begins  */
+	for (guint end = n_points - 1; end > 0; end = points[end].from) {
+
+		points[points[end].from].chinfo->breaks_before = true;
+
+	}
+
+}
+
+
+/**
+
+    gnui_flow_layout_allocate_masonry:
+    @manager:           (not nullable): The flow layout manager
+    @widget:            (not nullable): The widget currently adopting the flow
+                        layout manager
+    @priv:              (not nullable): Private `struct` of the
+                        `GnuiFlowLayout`
+    @available_width:   The available width
+    @available_height:  The available height
+
+    Allocate the children of a flow packed as masonry
+
+**/
+static void gnui_flow_layout_allocate_masonry (
+	GtkLayoutManager * const manager,
+	GtkWidget * const widget,
+	GnuiFlowLayoutPrivate * const priv,
+	const int available_width,
+	const int available_height
+) {
+
+	GnuiOrientableRequisition space;
+
+	const GnuiOrientablePositionFlags flags = gnui_flow_layout_get_space(
+		priv,
+		available_width,
+		available_height,
+		&space
+	);
+
+	gnui_flow_layout_pack_masonry(manager, widget, priv, &space, flags, true);
+
+	/*  The next row-based pass will have to break everything from scratch  */
+	priv->last_pass.first = NULL;
+	gnui_flow_layout_conclude_allocation(manager, priv, space.fix_size);
+
+}
+
+
+/**
+
+    gnui_flow_layout_measure:
+    @manager:           (auto) (not nullable): The flow layout manager
+    @widget:            (auto) (not nullable): The widget currently adopting
+                        the flow layout manager
+    @dimension:         (auto): The dimension that is being queried
+    @for_size:          (auto): The size of the other dimension, or `-1` if
+                        this is unknown
+    @minimum_size:      (auto) (optional) (out): A pointer for saving the
+						calculated minimum size
+    @natural_size:      (auto) (optional) (out): A pointer for saving the
+						calculated natural size
+    @minimum_baseline:  (auto) (optional) (out): A pointer for saving the
+						calculated minimum baseline
+    @natural_baseline:  (auto) (optional) (out): A pointer for saving the
+						calculated natural baseline
+
+    Class handler for the #GtkLayoutManager.measure() method on the flow layout
+    manager instance
+
+**/
+static void gnui_flow_layout_measure (
+	GtkLayoutManager * const manager,
+	GtkWidget * const widget,
+	const GtkOrientation dimension,
+	const gint for_size,
+	gint * const minimum_size,
+	gint * const natural_size,
+	gint * const minimum_baseline,
+	gint * const natural_baseline
+) {
+
+	GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(GNUI_FLOW_LAYOUT(manager));
+
+	GnuiFlowPrivate * const fpriv =
+		GNUI_IS_FLOW(widget) ?
+			gnui_flow_get_instance_private(GNUI_FLOW(widget))
+		:
+			NULL;
+
+	GnuiFlowChildLayoutPrivate * chinfo;
+	GtkWidget * child;
+	gint ret_min = 0, ret_nat = 0;
+
+	if (fpriv && fpriv->update_depth) {
+
+		/*  The flow is being updated: pretend that nothing has changed  */
+
+		const GnuiFlowFrozenSize * const frozen =
+			fpriv->frozen_sizes[dimension] + (
+				for_size >= 0 &&
+				fpriv->frozen_sizes[dimension][1].for_size == for_size
+			);
+
+		ret_min = frozen->minimum;
+		ret_nat = frozen->natural;
+		goto set_and_exit;
+
+	}
+
+	gnui_flow_layout_note_measure(priv, dimension, for_size);
+
+	/*  When the parent does not tell us the size along the orientation axis
+		we fall back on the one of the last allocation  */
+	const guint space =
+		dimension == priv->orientation ?
+			0
+		: for_size > -1 ?
+			*((guint *) &for_size)
+		:
+			priv->allocated_fix_size;
+
+	if (dimension != priv->orientation) {
+
+		priv->measured_fix_size = space;
+
+	}
+
+	if (fpriv && fpriv->model) {
+
+		ret_min = ret_nat =
+			gnui_flow_model_measure(widget, fpriv, priv, dimension, space);
+
+		goto save_and_exit;
+
+	}
+
+	if (priv->homogeneous) {
+
+		GnuiOrientableRequisition cell;
+		gint col_step, l_offset;
+		guint n_rows;
+
+		const guint n_children =
+			gnui_flow_layout_measure_cell(manager, widget, priv, &cell);
+
+		if (!n_children) {
+
+			goto save_and_exit;
+
+		}
+
+		if (space == 0) {
+
+			ret_min = ret_nat =
+				dimension == priv->orientation ?
+					(gint) cell.fix_size
+				:
+					(gint) cell.var_size;
+
+			goto save_and_exit;
+
+		}
+
+		n_rows = gnui_flow_layout_fit_lanes(
+			priv,
+			space,
+			n_children,
+			&cell.fix_size,
+			&col_step,
+			&l_offset
 		);
 
-		gtk_widget_measure(
-			child,
-			GNUI_PERPENDICULAR_ORIENTATION(priv->orientation),
-			-1,
-			NULL,
-			(gint *) &nexta.var_size,
-			NULL,
-			NULL
+		n_rows = (n_children + n_rows - 1) / n_rows;
+
+		ret_min = ret_nat =
+			(gint) (n_rows * cell.var_size) +
+			(gint) (n_rows - 1) * priv->leading;
+
+		goto save_and_exit;
+
+	}
+
+	if (space == 0) {
+
+		for (
+			child = gtk_widget_get_first_child(widget);
+				child;
+			child = gtk_widget_get_next_sibling(child)
+		) {
+
+			chinfo = gnui_flow_child_layout_get_instance_private(
+				GNUI_FLOW_CHILD_LAYOUT(
+					gtk_layout_manager_get_layout_child(manager, child)
+				)
+			);
+
+			gnui_flow_chinfo_ensure_requisition(chinfo, child, priv);
+
+			GNUI_SET_IF_GREATER__2_2(
+				ret_nat,
+				dimension == priv->orientation ?
+					(gint) chinfo->requisition.fix_size
+				:
+					(gint) chinfo->requisition.var_size
+			);
+
+		}
+
+		ret_min = ret_nat;
+		goto save_and_exit;
+
+	}
+
+	if (priv->packing == GNUI_FLOW_PACKING_MASONRY) {
+
+		ret_min = ret_nat = gnui_flow_layout_pack_masonry(
+			manager,
+			widget,
+			priv,
+			&(GnuiOrientableRequisition) { .fix_size = space },
+			GNUI_ORIENTABLE_POSITION_FLAG_NONE,
+			false
+		);
+
+		goto save_and_exit;
+
+	}
+
+	GnuiOrientableAllocation
+		nexta, preva = { 0 };
+
+	GnuiOrientableRequisition occupied = {
+		.fix_size = space,
+		.var_size = 0
+	};
+
+	guint row_size = 0, row_baseline = 0, row_below_baseline = 0;
+
+	if (priv->packing == GNUI_FLOW_PACKING_BALANCED) {
+
+		gnui_flow_layout_break_balanced(manager, widget, priv, space);
+
+	}
+
+	for (
+		child = gtk_widget_get_first_child(widget);
+			child;
+		child = gtk_widget_get_next_sibling(child)
+	) {
+
+		if (!gtk_widget_should_layout(child)) {
+
+			continue;
+
+		}
+
+		chinfo = gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(
+				gtk_layout_manager_get_layout_child(manager, child)
+			)
 		);
 
-		GNUI_NORMALIZE_INT_UINT_CAST__2(nexta.fix_size);
-		GNUI_NORMALIZE_INT_UINT_CAST__2(nexta.var_size);
+		gnui_flow_chinfo_ensure_requisition(chinfo, child, priv);
+		nexta.fix_size = chinfo->requisition.fix_size;
+		nexta.var_size = chinfo->requisition.var_size;
 
 		if (!row_size) {
 
 			nexta.fix_axis = 0;
 			nexta.var_axis = 0;
-			row_size = nexta.var_size;
+			row_baseline = row_below_baseline = 0;
 
 		} else if (
-			preva.fix_axis + preva.fix_size + nexta.fix_size +
-				priv->spacing > space
+			priv->packing == GNUI_FLOW_PACKING_BALANCED ?
+				chinfo->breaks_before
+			:
+				preva.fix_axis + preva.fix_size + nexta.fix_size +
+					priv->spacing > space
 		) {
 
 			nexta.fix_axis = 0;
 			nexta.var_axis = preva.var_axis + row_size + priv->leading;
-			row_size = nexta.var_size;
+			row_size = row_baseline = row_below_baseline = 0;
 
 		} else {
 
 			nexta.fix_axis = preva.fix_axis + preva.fix_size + priv->spacing;
 			nexta.var_axis = preva.var_axis;
-			GNUI_SET_IF_GREATER__2_2(row_size, nexta.var_size);
 
 		}
 
+		gnui_flow_row_fit_child(
+			&row_size,
+			&row_baseline,
+			&row_below_baseline,
+			nexta.var_size,
+			priv->row_align == GTK_ALIGN_BASELINE && !gtk_widget_compute_expand(
+				child,
+				GNUI_PERPENDICULAR_ORIENTATION(priv->orientation)
+			) ?
+				chinfo->baselines.var_axis
+			:
+				-1
+		);
+
 		GNUI_SET_IF_GREATER__2_2(occupied.fix_size, nexta.fix_size);
 		GNUI_SET_IF_GREATER__2_2(occupied.var_size, nexta.var_axis + row_size);
 		preva = nexta;
@@ -713,6 +4272,22 @@ static void gnui_flow_layout_measure (
 	 \/     ________________________     \ */
 
 
+	if (fpriv) {
+
+		fpriv->frozen_sizes[dimension][for_size >= 0] = (GnuiFlowFrozenSize) {
+			.for_size = for_size,
+			.minimum = ret_min,
+			.natural = ret_nat
+		};
+
+	}
+
+
+	/* \                                  /\
+	\ */     set_and_exit:               /* \
+	 \/     ________________________     \ */
+
+
 	GNUI_SET_POINTED_VALUE_IF_GIVEN__2_1(minimum_size, ret_min);
 	GNUI_SET_POINTED_VALUE_IF_GIVEN__2_1(natural_size, ret_nat);
 	GNUI_SET_POINTED_VALUE_IF_GIVEN__2_1(minimum_baseline, -1);
@@ -721,6 +4296,137 @@ static void gnui_flow_layout_measure (
 }
 
 
+/**
+
+    gnui_flow_layout_find_resume_point:
+    @manager:       (not nullable): The flow layout manager
+    @priv:          (not nullable): Private `struct` of @manager
+    @first_chinfo:  (not nullable): Private `struct` of the first child that
+                    must be laid out
+    @first_child:   (not nullable): The first child that must be laid out
+    @fix_size:      The available size along the orientation axis
+
+    Compare the children that must be laid out with those that were laid out
+    during the last allocation and find the first row that might be affected by
+    the changes
+
+    The children that precede the first change are still walked (GTK does not
+    tell which ones have queued a resize), but nothing is computed for them
+    besides their cached size requests.
+
+    Returns:    Private `struct` of the first child of the first row that must
+                be broken again, or @first_chinfo if the whole flow must be
+                broken from scratch
+
+**/
+static GnuiFlowChildLayoutPrivate * gnui_flow_layout_find_resume_point (
+	GtkLayoutManager * const manager,
+	const GnuiFlowLayoutPrivate * const priv,
+	GnuiFlowChildLayoutPrivate * const first_chinfo,
+	GtkWidget * const first_child,
+	const guint fix_size
+) {
+
+	if (
+		priv->last_pass.first != first_chinfo ||
+		first_chinfo->child != first_child ||
+		priv->last_pass.fix_size != fix_size ||
+		priv->last_pass.spacing != priv->spacing ||
+		priv->last_pass.leading != priv->leading ||
+		priv->last_pass.row_align != priv->row_align ||
+		priv->last_pass.packing != priv->packing ||
+		priv->packing == GNUI_FLOW_PACKING_BALANCED
+	) {
+
+		return first_chinfo;
+
+	}
+
+	GnuiFlowChildLayoutPrivate
+		* chinfo = first_chinfo,
+		* row_head = first_chinfo,
+		* next_chinfo;
+
+	GnuiOrientableRequisition requisition;
+	gint baseline;
+	GtkWidget * child = first_child;
+
+
+	/* \                                  /\
+	\ */     compare_children:           /* \
+	 \/     ________________________     \ */
+
+
+	requisition = chinfo->requisition;
+	baseline = chinfo->baselines.var_axis;
+	gnui_flow_chinfo_ensure_requisition(chinfo, child, priv);
+
+	if (
+		requisition.fix_size != chinfo->requisition.fix_size ||
+		requisition.var_size != chinfo->requisition.var_size ||
+		baseline != chinfo->baselines.var_axis ||
+		chinfo->fexpand != (bool) gtk_widget_compute_expand(
+			child,
+			priv->orientation
+		) || chinfo->pexpand != (bool) gtk_widget_compute_expand(
+			child,
+			GNUI_PERPENDICULAR_ORIENTATION(priv->orientation)
+		)
+	) {
+
+		return row_head;
+
+	}
+
+	if (chinfo->row.starts_here) {
+
+		row_head = chinfo;
+
+	}
+
+
+	/* \                                  /\
+	\ */     get_next_comparable:        /* \
+	 \/     ________________________     \ */
+
+
+	child = gtk_widget_get_next_sibling(child);
+
+	if (child && !gtk_widget_should_layout(child)) {
+
+		goto get_next_comparable;
+
+	}
+
+	/*  ==> End of loop `get_next_comparable`  */
+
+	if (!child) {
+
+		return row_head;
+
+	}
+
+	next_chinfo = gnui_flow_child_layout_get_instance_private(
+		GNUI_FLOW_CHILD_LAYOUT(
+			gtk_layout_manager_get_layout_child(manager, child)
+		)
+	);
+
+	/*  Newly created children have a `NULL` `child` member  */
+	if (chinfo->next != next_chinfo || next_chinfo->child != child) {
+
+		return row_head;
+
+	}
+
+	chinfo = next_chinfo;
+	goto compare_children;
+
+	/*  ==> End of loop `compare_children`  */
+
+}
+
+
 /**
 
     gnui_flow_layout_allocate:
@@ -743,6 +4449,98 @@ static void gnui_flow_layout_allocate (
 	const int baseline G_GNUC_UNUSED
 ) {
 
+	GnuiFlowPrivate * const fpriv =
+		GNUI_IS_FLOW(widget) ?
+			gnui_flow_get_instance_private(GNUI_FLOW(widget))
+		:
+			NULL;
+
+	if (fpriv) {
+
+		if (fpriv->update_depth) {
+
+			/*  The flow is being updated: GTK keeps the children that we
+				have already placed where they are, the others must wait
+				(only children added since the last look can be unplaced)  */
+			if (
+				!fpriv->model && (
+					fpriv->has_new_children ||
+					fpriv->frozen_edges[0] !=
+						gtk_widget_get_first_child(widget) ||
+					fpriv->frozen_edges[1] !=
+						gtk_widget_get_last_child(widget)
+				)
+			) {
+
+				gnui_flow_layout_hide_unplaced_children(manager, widget);
+				fpriv->frozen_edges[0] = gtk_widget_get_first_child(widget);
+				fpriv->frozen_edges[1] = gtk_widget_get_last_child(widget);
+				fpriv->has_new_children = false;
+
+			}
+
+			return;
+
+		}
+
+		if (fpriv->model) {
+
+			gnui_flow_model_allocate(
+				manager,
+				widget,
+				fpriv,
+				available_width,
+				available_height
+			);
+
+			return;
+
+		}
+
+	}
+
+	if (
+		(
+			(GnuiFlowLayoutPrivate *)
+				gnui_flow_layout_get_instance_private(
+					GNUI_FLOW_LAYOUT(manager)
+				)
+		)->homogeneous
+	) {
+
+		gnui_flow_layout_allocate_homogeneous(
+			manager,
+			widget,
+			gnui_flow_layout_get_instance_private(GNUI_FLOW_LAYOUT(manager)),
+			available_width,
+			available_height
+		);
+
+		return;
+
+	}
+
+	if (
+		(
+			(GnuiFlowLayoutPrivate *)
+				gnui_flow_layout_get_instance_private(
+					GNUI_FLOW_LAYOUT(manager)
+				)
+		)->packing == GNUI_FLOW_PACKING_MASONRY
+	) {
+
+		gnui_flow_layout_allocate_masonry(
+			manager,
+			widget,
+			gnui_flow_layout_get_instance_private(GNUI_FLOW_LAYOUT(manager)),
+			available_width,
+			available_height
+		);
+
+		return;
+
+	}
+
 	/*  Part I. Measuring and connecting  */
 
 	GtkWidget * child = gtk_widget_get_first_child(widget);
@@ -755,6 +4553,11 @@ static void gnui_flow_layout_allocate (
 
 	if (!child) {
 
+		GnuiFlowLayoutPrivate * const priv =
+			gnui_flow_layout_get_instance_private(GNUI_FLOW_LAYOUT(manager));
+
+		g_array_set_size(priv->indexed_rows, 0);
+		g_array_set_size(priv->indexed_children, 0);
 		return;
 
 	}
@@ -771,7 +4574,7 @@ static void gnui_flow_layout_allocate (
 	GtkAllocation child_allocation;
 	GnuiOrientableAllocation nexta, _alloc_placeholder_1_ = { 0 };
 	GnuiOrientableRequisition occupied, space;
-	GnuiFlowChildLayoutPrivate * chinfo;
+	GnuiFlowChildLayoutPrivate * chinfo, * resume_chinfo;
 	GnuiFlowRowInfo * roinfo;
 
 	GnuiFlowChildLayoutPrivate * const first_chinfo =
@@ -801,9 +4604,6 @@ static void gnui_flow_layout_allocate (
 	if (priv->orientation == GTK_ORIENTATION_VERTICAL) new_flags |=
 		GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL;
 
-	n_ro_to_expand = 0;
-	n_rows = 1;
-
 	if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
 
 		space.fix_size = available_height;
@@ -816,59 +4616,89 @@ static void gnui_flow_layout_allocate (
 
 	}
 
-	occupied.fix_size = space.fix_size;
-	occupied.var_size = 0;
-	chinfo = first_chinfo;
-	chinfo->prev = NULL;
-	chinfo->row.first_row = true;
-	roinfo = &chinfo->row;
+	if (priv->packing == GNUI_FLOW_PACKING_BALANCED) {
 
+		gnui_flow_layout_break_balanced(manager, widget, priv, space.fix_size);
 
-	/* \                                  /\
-	\ */     measure_children:           /* \
-	 \/     ________________________     \ */
-
+	}
 
-	gtk_widget_measure(
+	chinfo = resume_chinfo = gnui_flow_layout_find_resume_point(
+		manager,
+		priv,
+		first_chinfo,
 		child,
-		priv->orientation,
-		-1,
-		NULL,
-		(gint *) &nexta.fix_size,
-		NULL,
-		&chinfo->baselines.fix_axis
+		space.fix_size
 	);
 
-	gtk_widget_measure(
-		child,
-		GNUI_PERPENDICULAR_ORIENTATION(priv->orientation),
-		-1,
-		NULL,
-		(gint *) &nexta.var_size,
-		NULL,
-		&chinfo->baselines.var_axis
-	);
+	if (chinfo == first_chinfo) {
+
+		/*  Everything must be broken from scratch  */
+
+		n_ro_to_expand = 0;
+		n_rows = 0;
+		occupied.fix_size = space.fix_size;
+		occupied.var_size = 0;
+		chinfo->prev = NULL;
+
+	} else {
+
+		/*  Resume from the first row that might have changed  */
 
-	GNUI_NORMALIZE_INT_UINT_CAST__2(nexta.fix_size);
-	GNUI_NORMALIZE_INT_UINT_CAST__2(nexta.var_size);
+		child = chinfo->child;
+		n_ro_to_expand = chinfo->row.n_ro_to_expand_before;
+		n_rows = chinfo->row.index;
+		occupied = chinfo->row.occupied_before;
+		preva = chinfo->prev->allocation;
+
+		for (
+			roinfo = &chinfo->prev->row;
+				!roinfo->starts_here;
+			roinfo = &GNUI_CONTAINER_OF(
+				roinfo,
+				GnuiFlowChildLayoutPrivate,
+				row
+			)->prev->row
+		);
+
+	}
+
+
+	/* \                                  /\
+	\ */     measure_children:           /* \
+	 \/     ________________________     \ */
+
+
+	gnui_flow_chinfo_ensure_requisition(chinfo, child, priv);
+	nexta.fix_size = chinfo->requisition.fix_size;
+	nexta.var_size = chinfo->requisition.var_size;
 
 	if (!chinfo->prev) {
 
 		/*  This is the first widget  */
 
 		nexta.fix_axis = nexta.var_axis = 0;
-		roinfo->row_size = nexta.var_size;
-		roinfo->n_children = 1;
+		roinfo = &chinfo->row;
+
+		gnui_flow_row_init(
+			roinfo,
+			n_rows++,
+			n_ro_to_expand,
+			&occupied,
+			nexta.var_size
+		);
+
+		roinfo->first_row = true;
 
 	} else if (
-		preva.fix_axis + preva.fix_size +
-			nexta.fix_size + priv->spacing > space.fix_size
+		priv->packing == GNUI_FLOW_PACKING_BALANCED ?
+			chinfo->breaks_before
+		:
+			preva.fix_axis + preva.fix_size +
+				nexta.fix_size + priv->spacing > space.fix_size
 	) {
 
 		/*  This widget starts a new line  */
 
-		roinfo->starts_here = true;
-
 		roinfo->l_space =
 			preva.fix_axis + preva.fix_size < space.fix_size ?
 				space.fix_size - preva.fix_axis - preva.fix_size
@@ -878,10 +4708,14 @@ static void gnui_flow_layout_allocate (
 		nexta.fix_axis = 0;
 		nexta.var_axis = preva.var_axis + roinfo->row_size + priv->leading;
 		roinfo = &chinfo->row;
-		roinfo->n_ch_to_expand = 0;
-		roinfo->n_children = 1;
-		roinfo->row_size = nexta.var_size;
-		n_rows++;
+
+		gnui_flow_row_init(
+			roinfo,
+			n_rows++,
+			n_ro_to_expand,
+			&occupied,
+			nexta.var_size
+		);
 
 	} else {
 
@@ -889,34 +4723,43 @@ static void gnui_flow_layout_allocate (
 
 		nexta.fix_axis = preva.fix_axis + preva.fix_size + priv->spacing;
 		nexta.var_axis = preva.var_axis;
-		GNUI_SET_IF_GREATER__2_2(roinfo->row_size, nexta.var_size);
 		roinfo->n_children++;
+		memset(&chinfo->row, 0, sizeof(GnuiFlowRowInfo));
 
 	}
 
 	chinfo->fexpand = gtk_widget_compute_expand(child, priv->orientation);
 
-	if (chinfo->fexpand) {
-
-		roinfo->n_ch_to_expand++;
+	chinfo->pexpand = gtk_widget_compute_expand(
+		child,
+		GNUI_PERPENDICULAR_ORIENTATION(priv->orientation)
+	);
 
-	}
+	if (chinfo->fexpand) {
 
-	if (
-		!roinfo->vexpand && gtk_widget_compute_expand(
-			child,
-			new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL ?
-				GTK_ORIENTATION_HORIZONTAL
-			:
-				GTK_ORIENTATION_VERTICAL
-		)
-	) {
+		roinfo->n_ch_to_expand++;
+
+	}
+
+	if (!roinfo->vexpand && chinfo->pexpand) {
 
 		roinfo->vexpand = true;
 		n_ro_to_expand++;
 
 	}
 
+	/*  Baselines have been collected together with the size requests  */
+	gnui_flow_row_fit_child(
+		&roinfo->row_size,
+		&roinfo->baseline,
+		&roinfo->below_baseline,
+		nexta.var_size,
+		priv->row_align == GTK_ALIGN_BASELINE && !chinfo->pexpand ?
+			chinfo->baselines.var_axis
+		:
+			-1
+	);
+
 	GNUI_SET_IF_GREATER__2_2(occupied.fix_size, nexta.fix_size);
 
 	GNUI_SET_IF_GREATER__2_2(
@@ -927,6 +4770,13 @@ static void gnui_flow_layout_allocate (
 	chinfo->allocation = preva = nexta;
 	chinfo->child = child;
 
+	if (fpriv && fpriv->children_index && !chinfo->index_iter) {
+
+		/*  A child has been added without passing through the flow API  */
+		gnui_flow_children_index_drop(fpriv);
+
+	}
+
 
 	/* \                                  /\
 	\ */     get_next_measurable:        /* \
@@ -969,7 +4819,6 @@ static void gnui_flow_layout_allocate (
 		:
 			0;
 
-	roinfo->starts_here = true;
 	roinfo->last_row = true;
 	chinfo->next = NULL;
 
@@ -978,9 +4827,13 @@ static void gnui_flow_layout_allocate (
 	const bool
 		p_no_big_guys = n_ro_to_expand < 1,
 		p_fill_evenly =
-			p_no_big_guys && priv->page_justify == GTK_JUSTIFY_FILL;
+			p_no_big_guys && priv->page_justify == GTK_JUSTIFY_FILL,
+		page_is_stable =
+			p_no_big_guys && priv->page_justify == GTK_JUSTIFY_LEFT &&
+			!(new_flags & GNUI_ORIENTABLE_POSITION_FLAG_P_RTL);
 
 	bool l_fill_evenly, l_no_big_guys;
+	gint child_baseline;
 
 	guint
 		_uint_placeholder_3_,
@@ -1007,9 +4860,47 @@ static void gnui_flow_layout_allocate (
 	#define l_exp_quota _uint_placeholder_2_
 	#define l_n_larger_exp_quota _uint_placeholder_3_
 
-	chinfo = first_chinfo;
 	memset(&_alloc_placeholder_1_, 0, sizeof(next_offset));
 
+	if (
+		resume_chinfo != first_chinfo &&
+		page_is_stable &&
+		priv->last_pass.page_is_stable &&
+		priv->last_pass.line_justify == priv->line_justify &&
+		priv->last_pass.line_direction == priv->line_direction &&
+		priv->indexed_rows->len > resume_chinfo->row.index
+	) {
+
+		/*  The rows that precede the resumed one would get exactly the same
+			allocations they got last time: skip them (GTK will take care of
+			the children that still need to be allocated) and keep their
+			entries in the row index  */
+
+		chinfo = resume_chinfo;
+		next_offset.var_axis = chinfo->allocation.var_axis;
+
+		g_array_set_size(
+			priv->indexed_children,
+			g_array_index(
+				priv->indexed_rows,
+				GnuiFlowIndexedRow,
+				chinfo->row.index
+			).first_child
+		);
+
+		g_array_set_size(priv->indexed_rows, chinfo->row.index);
+
+	} else {
+
+		chinfo = first_chinfo;
+		g_array_set_size(priv->indexed_rows, 0);
+		g_array_set_size(priv->indexed_children, 0);
+
+	}
+
+	priv->indexed_fix_size = space.fix_size;
+	priv->indexed_flags = new_flags;
+
 	do {
 
 		roinfo = &chinfo->row;
@@ -1095,81 +4986,517 @@ static void gnui_flow_layout_allocate (
 
 				nexta.var_axis += p_space / 2;
 
-			}
+			}
+
+			if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_P_RTL) {
+
+				nexta.var_axis =
+					space.var_size - nexta.var_axis - nexta.var_size;
+
+			}
+
+			if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
+
+				child_allocation.width = nexta.var_size;
+				child_allocation.height = nexta.fix_size;
+				child_allocation.x = nexta.var_axis;
+				child_allocation.y = nexta.fix_axis;
+
+			} else {
+
+				child_allocation.width = nexta.fix_size;
+				child_allocation.height = nexta.var_size;
+				child_allocation.x = nexta.fix_axis;
+				child_allocation.y = nexta.var_axis;
+
+			}
+
+			/*  Children that expand perpendicularly always fill their row  */
+			child_baseline = chinfo->pexpand ? -1 : gnui_flow_align_in_row(
+				priv->row_align,
+				chinfo->requisition.var_size,
+				chinfo->baselines.var_axis,
+				roinfo->baseline,
+				new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL ?
+					&child_allocation.x
+				:
+					&child_allocation.y,
+				new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL ?
+					&child_allocation.width
+				:
+					&child_allocation.height
+			);
+
+			if (roinfo == &chinfo->row) {
+
+				new_flags |= GNUI_ORIENTABLE_POSITION_FLAG_IS_L_START;
+
+				g_array_append_vals(
+					priv->indexed_rows,
+					&(GnuiFlowIndexedRow) {
+						.var_axis = nexta.var_axis,
+						.var_size = nexta.var_size,
+						.first_child = priv->indexed_children->len
+					},
+					1
+				);
+
+			}
+
+			if (roinfo->first_row) new_flags |=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_P_START;
+			if (!chinfo->next || chinfo->next->row.starts_here) new_flags |=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_L_END;
+			if (roinfo->last_row) new_flags |=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_P_END;
+
+			chinfo->indexed_slot = priv->indexed_children->len;
+
+			g_array_append_vals(
+				priv->indexed_children,
+				&(GnuiFlowIndexedChild) {
+					.allocation = child_allocation,
+					.child = child
+				},
+				1
+			);
+
+			if (priv->positional_classes) {
+
+				gnui_flow_chinfo_update_style_classes(chinfo, new_flags);
+
+			}
+
+			gnui_flow_chinfo_mark_placed(chinfo, child);
+
+			gtk_widget_size_allocate(
+				child,
+				&child_allocation,
+				child_baseline
+			);
+
+			new_flags &=
+				GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL |
+				GNUI_ORIENTABLE_POSITION_FLAG_L_RTL |
+				GNUI_ORIENTABLE_POSITION_FLAG_P_RTL;
+
+		} while ((chinfo = chinfo->next) && !chinfo->row.starts_here);
+
+		next_offset.fix_axis = 0;
+		next_offset.var_axis += nexta.var_size + priv->leading;
+
+		if (p_fill_evenly || roinfo->vexpand) {
+
+			p_n_exp--;
+
+		}
+
+	} while (chinfo);
+
+	#undef l_n_larger_exp_quota
+	#undef l_exp_quota
+	#undef l_n_exp
+	#undef next_offset
+
+	priv->last_pass = (GnuiFlowLastPass) {
+		.first = first_chinfo,
+		.fix_size = space.fix_size,
+		.spacing = priv->spacing,
+		.leading = priv->leading,
+		.line_justify = priv->line_justify,
+		.line_direction = priv->line_direction,
+		.row_align = priv->row_align,
+		.packing = priv->packing,
+		.page_is_stable = page_is_stable
+	};
+
+	gnui_flow_layout_conclude_allocation(manager, priv, space.fix_size);
+
+}
+
+
+/**
+
+    gnui_flow_layout_scan_indexed_children:
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @x:         The horizontal coordinate
+    @y:         The vertical coordinate
+
+    Find the indexed child that contains a point by scanning the whole index
+
+    Returns:    The position of the child in the index, or `-1`
+
+**/
+static gint gnui_flow_layout_scan_indexed_children (
+	const GnuiFlowLayoutPrivate * const priv,
+	const gint x,
+	const gint y
+) {
+
+	const GtkAllocation * rect;
+
+	for (guint idx = 0; idx < priv->indexed_children->len; idx++) {
+
+		rect = &g_array_index(
+			priv->indexed_children,
+			GnuiFlowIndexedChild,
+			idx
+		).allocation;
+
+		if (
+			x >= rect->x && x < rect->x + rect->width &&
+			y >= rect->y && y < rect->y + rect->height
+		) {
+
+			return idx;
+
+		}
+
+	}
+
+	return -1;
+
+}
+
+
+/**
+
+    gnui_flow_layout_find_indexed_row:
+    @priv:          (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @var_offset:    An offset perpendicular to the orientation axis
+
+    Perform a binary search on the row index
+
+    Returns:    The index of the row that contains @var_offset, or `-1` if
+                @var_offset falls outside of all the rows
+
+**/
+static gint gnui_flow_layout_find_indexed_row (
+	const GnuiFlowLayoutPrivate * const priv,
+	const gint var_offset
+) {
+
+	const GnuiFlowIndexedRow * irow;
+	guint middle, lower = 0, upper = priv->indexed_rows->len;
+
+	/*  With a right-to-left page the rows are indexed in descending order  */
+	const bool is_descending =
+		priv->indexed_flags & GNUI_ORIENTABLE_POSITION_FLAG_P_RTL;
+
+	while (lower < upper) {
+
+		middle = lower + (upper - lower) / 2;
+		irow = &g_array_index(priv->indexed_rows, GnuiFlowIndexedRow, middle);
+
+		if (
+			is_descending ?
+				irow->var_axis <= var_offset
+			:
+				irow->var_axis + (gint) irow->var_size > var_offset
+		) {
+
+			upper = middle;
+
+		} else {
+
+			lower = middle + 1;
+
+		}
+
+	}
+
+	if (lower >= priv->indexed_rows->len) {
+
+		return -1;
+
+	}
+
+	irow = &g_array_index(priv->indexed_rows, GnuiFlowIndexedRow, lower);
+
+	return
+		var_offset >= irow->var_axis &&
+		var_offset < irow->var_axis + (gint) irow->var_size ?
+			(gint) lower
+		:
+			-1;
+
+}
+
+
+/**
+
+    gnui_flow_layout_find_indexed_child:
+    @priv:          (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @row_idx:       The index of the row where to search
+    @fix_offset:    An offset along the orientation axis
+
+    Perform a binary search on the indexed children of a row
+
+    Returns:    The index of the child that contains @fix_offset, or `-1` if
+                @fix_offset falls outside of all the children of the row
+
+**/
+static gint gnui_flow_layout_find_indexed_child (
+	const GnuiFlowLayoutPrivate * const priv,
+	const guint row_idx,
+	const gint fix_offset
+) {
+
+	const bool
+		is_vertical =
+			priv->indexed_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL,
+		is_descending =
+			priv->indexed_flags & GNUI_ORIENTABLE_POSITION_FLAG_L_RTL;
+
+	const GtkAllocation * rect;
+	gint child_start, child_end;
+
+	guint
+		middle,
+		lower = g_array_index(
+			priv->indexed_rows,
+			GnuiFlowIndexedRow,
+			row_idx
+		).first_child,
+		upper =
+			row_idx + 1 < priv->indexed_rows->len ?
+				g_array_index(
+					priv->indexed_rows,
+					GnuiFlowIndexedRow,
+					row_idx + 1
+				).first_child
+			:
+				priv->indexed_children->len;
+
+	const guint row_end = upper;
+
+	while (lower < upper) {
+
+		middle = lower + (upper - lower) / 2;
+
+		rect = &g_array_index(
+			priv->indexed_children,
+			GnuiFlowIndexedChild,
+			middle
+		).allocation;
+
+		gnui_flow_rect_get_fix_extremes(
+			rect,
+			is_vertical,
+			&child_start,
+			&child_end
+		);
+
+		if (
+			is_descending ? child_start <= fix_offset : child_end > fix_offset
+		) {
+
+			upper = middle;
+
+		} else {
+
+			lower = middle + 1;
+
+		}
+
+	}
+
+	if (lower >= row_end) {
+
+		return -1;
+
+	}
+
+	rect = &g_array_index(
+		priv->indexed_children,
+		GnuiFlowIndexedChild,
+		lower
+	).allocation;
+
+	gnui_flow_rect_get_fix_extremes(
+		rect,
+		is_vertical,
+		&child_start,
+		&child_end
+	);
+
+	return
+		fix_offset >= child_start && fix_offset < child_end ?
+			(gint) lower
+		:
+			-1;
+
+}
+
+
+/**
+
+    gnui_flow_layout_find_indexed_slot:
+    @priv:      (not nullable): Private `struct` of the `GnuiFlowLayout`
+    @x:         The horizontal coordinate
+    @y:         The vertical coordinate
+
+    Find the indexed child that contains a point
+
+    Returns:    The position of the child in the index of the laid out
+                children, or `-1`
+
+**/
+static gint gnui_flow_layout_find_indexed_slot (
+	const GnuiFlowLayoutPrivate * const priv,
+	const gint x,
+	const gint y
+) {
+
+	const bool is_vertical =
+		priv->indexed_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL;
+
+	if (priv->packing == GNUI_FLOW_PACKING_MASONRY && !priv->homogeneous) {
+
+		/*  Masonry has no rows to bisect: scan the children  */
+		return gnui_flow_layout_scan_indexed_children(priv, x, y);
+
+	}
+
+	const gint row_idx =
+		gnui_flow_layout_find_indexed_row(priv, is_vertical ? x : y);
+
+	return
+		row_idx < 0 ?
+			-1
+		:
+			gnui_flow_layout_find_indexed_child(
+				priv,
+				row_idx,
+				is_vertical ? y : x
+			);
+
+}
+
+
+/**
+
+    gnui_flow_layout_lookup_indexed_child:
+    @manager:   (not nullable): The flow layout manager
+    @priv:      (not nullable): Private `struct` of @manager
+    @child:     (not nullable): A child of the widget that adopts @manager
+
+    Find the entry that the last allocation has recorded for a child
+
+    Returns:    (nullable): The entry of @child, or `NULL` if @child was not
+                laid out during the last allocation
+
+**/
+static const GnuiFlowIndexedChild * gnui_flow_layout_lookup_indexed_child (
+	GtkLayoutManager * const manager,
+	const GnuiFlowLayoutPrivate * const priv,
+	GtkWidget * const child
+) {
+
+	const guint slot = (
+		(GnuiFlowChildLayoutPrivate *)
+			gnui_flow_child_layout_get_instance_private(
+				GNUI_FLOW_CHILD_LAYOUT(
+					gtk_layout_manager_get_layout_child(manager, child)
+				)
+			)
+	)->indexed_slot;
+
+	if (slot >= priv->indexed_children->len) {
+
+		return NULL;
+
+	}
+
+	const GnuiFlowIndexedChild * const entry =
+		&g_array_index(priv->indexed_children, GnuiFlowIndexedChild, slot);
+
+	return entry->child == child ? entry : NULL;
+
+}
+
+
+/**
+
+    gnui_flow_layout_get_position_of_child:
+    @widget:    (not nullable): The widget that adopts the flow layout manager
+    @child:     (not nullable): A child of @widget
+
+    Get the position of a child among all the children of a widget (hidden
+    children included)
+
+    `GnuiFlow` answers in O(log n) thanks to its children index, any other
+    widget is walked.
+
+    Returns:    The position of @child
+
+**/
+static gint gnui_flow_layout_get_position_of_child (
+	GtkWidget * const widget,
+	GtkWidget * child
+) {
+
+	if (GNUI_IS_FLOW(widget)) {
+
+		return gnui_flow_get_index_of_child(GNUI_FLOW(widget), child);
+
+	}
 
-			if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_P_RTL) {
+	gint position = 0;
 
-				nexta.var_axis =
-					space.var_size - nexta.var_axis - nexta.var_size;
+	while ((child = gtk_widget_get_prev_sibling(child))) {
 
-			}
+		position++;
 
-			if (new_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL) {
+	}
 
-				child_allocation.width = nexta.var_size;
-				child_allocation.height = nexta.fix_size;
-				child_allocation.x = nexta.var_axis;
-				child_allocation.y = nexta.fix_axis;
+	return position;
 
-			} else {
+}
 
-				child_allocation.width = nexta.fix_size;
-				child_allocation.height = nexta.var_size;
-				child_allocation.x = nexta.fix_axis;
-				child_allocation.y = nexta.var_axis;
 
-			}
+/**
 
-			if (roinfo == &chinfo->row) new_flags |=
-				GNUI_ORIENTABLE_POSITION_FLAG_IS_L_START;
-			if (roinfo->first_row) new_flags |=
-				GNUI_ORIENTABLE_POSITION_FLAG_IS_P_START;
-			if (!chinfo->next || chinfo->next->row.starts_here) new_flags |=
-				GNUI_ORIENTABLE_POSITION_FLAG_IS_L_END;
-			if (roinfo->last_row) new_flags |=
-				GNUI_ORIENTABLE_POSITION_FLAG_IS_P_END;
+    gnui_flow_layout_get_nth_child:
+    @widget:    (not nullable): The widget that adopts the flow layout manager
+    @index:     The position of the child among all the children of @widget
+                (hidden children included)
 
-			gnui_flow_chinfo_update_style_classes(chinfo, new_flags);
+    Get the nth child of a widget
 
-			/*  TODO: Add support for baseline alignment  */
-			gtk_widget_size_allocate(
-				child,
-				&child_allocation,
-				-1 /*chinfo->baselines.var_axis*/
-			);
+    `GnuiFlow` answers in O(log n) thanks to its children index, any other
+    widget is walked.
 
-			new_flags &=
-				GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL |
-				GNUI_ORIENTABLE_POSITION_FLAG_L_RTL |
-				GNUI_ORIENTABLE_POSITION_FLAG_P_RTL;
+    Returns:    (transfer none) (nullable): The child at @index, or `NULL`
 
-		} while ((chinfo = chinfo->next) && !chinfo->row.starts_here);
+**/
+static GtkWidget * gnui_flow_layout_get_nth_child (
+	GtkWidget * const widget,
+	const guint index
+) {
 
-		next_offset.fix_axis = 0;
-		next_offset.var_axis += nexta.var_size + priv->leading;
+	if (index > G_MAXINT) {
 
-		if (p_fill_evenly || roinfo->vexpand) {
+		return NULL;
 
-			p_n_exp--;
+	}
 
-		}
+	if (GNUI_IS_FLOW(widget)) {
 
-		memset(roinfo, 0, sizeof(GnuiFlowRowInfo));
+		return gnui_flow_get_child_at_index(GNUI_FLOW(widget), (gint) index);
 
-	} while (chinfo);
+	}
 
-	#undef l_n_larger_exp_quota
-	#undef l_exp_quota
-	#undef l_n_exp
-	#undef next_offset
+	GtkWidget * child = gtk_widget_get_first_child(widget);
 
-	if (priv->allocated_fix_size != occupied.fix_size) {
+	for (guint idx = 0; child && idx < index; idx++) {
 
-		priv->allocated_fix_size = occupied.fix_size;
-		gtk_layout_manager_layout_changed(manager);
+		child = gtk_widget_get_next_sibling(child);
 
 	}
 
+	return child;
+
 }
 
 
@@ -1203,6 +5530,31 @@ static GtkSizeRequestMode gnui_flow_layout_get_request_mode (
 }
 
 
+/**
+
+    gnui_flow_layout_finalize:
+    @object:    (auto) (not nullable): The flow layout manager passed as
+                `GObject`
+
+    Class handler for the #Object.finalize() method on the flow layout manager
+    instance
+
+**/
+static void gnui_flow_layout_finalize (
+	GObject * const object
+) {
+
+	GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(GNUI_FLOW_LAYOUT(object));
+
+	g_array_unref(priv->indexed_rows);
+	g_array_unref(priv->indexed_children);
+	g_array_unref(priv->breakpoints);
+	G_OBJECT_CLASS(gnui_flow_layout_parent_class)->finalize(object);
+
+}
+
+
 /**
 
     gnui_flow_layout_get_property:
@@ -1257,6 +5609,26 @@ static void gnui_flow_layout_get_property (
 			g_value_set_enum(value, priv->line_justify);
 			return;
 
+		case FLOW_LAYOUT_PROPERTY_POSITIONAL_CLASSES:
+
+			g_value_set_boolean(value, priv->positional_classes);
+			return;
+
+		case FLOW_LAYOUT_PROPERTY_ROW_ALIGN:
+
+			g_value_set_enum(value, priv->row_align);
+			return;
+
+		case FLOW_LAYOUT_PROPERTY_PACKING:
+
+			g_value_set_enum(value, priv->packing);
+			return;
+
+		case FLOW_LAYOUT_PROPERTY_HOMOGENEOUS:
+
+			g_value_set_boolean(value, priv->homogeneous);
+			return;
+
 		case FLOW_LAYOUT_PROPERTY_SPACING:
 
 			g_value_set_int(value, priv->spacing);
@@ -1368,6 +5740,50 @@ static void gnui_flow_layout_set_property (
 			priv->line_justify = val.u;
 			break;
 
+		case FLOW_LAYOUT_PROPERTY_POSITIONAL_CLASSES:
+
+			gnui_flow_layout_update_positional_classes(
+				GNUI_FLOW_LAYOUT(object),
+				gtk_layout_manager_get_widget(GTK_LAYOUT_MANAGER(object)),
+				g_value_get_boolean(value)
+			);
+
+			/*  Keep `return` here!  */
+			return;
+
+		case FLOW_LAYOUT_PROPERTY_ROW_ALIGN:
+
+			if (priv->row_align == (val.u = g_value_get_enum(value))) {
+
+				return;
+
+			}
+
+			priv->row_align = val.u;
+			break;
+
+		case FLOW_LAYOUT_PROPERTY_PACKING:
+
+			if (priv->packing == (val.u = g_value_get_enum(value))) {
+
+				return;
+
+			}
+
+			priv->packing = val.u;
+			break;
+
+		case FLOW_LAYOUT_PROPERTY_HOMOGENEOUS:
+
+			if (priv->homogeneous == (val.u = g_value_get_boolean(value))) {
+
+				return;
+
+			}
+
+			priv->homogeneous = val.u;
+			break;
+
 		case FLOW_LAYOUT_PROPERTY_SPACING:
 
 			if (priv->spacing == (val.d = g_value_get_int(value))) {
@@ -1411,6 +5827,7 @@ static void gnui_flow_layout_class_init (
 	GtkLayoutManagerClass * const layout_class =
 		GTK_LAYOUT_MANAGER_CLASS(klass);
 
+	object_class->finalize = gnui_flow_layout_finalize;
 	object_class->set_property = gnui_flow_layout_set_property;
 	object_class->get_property = gnui_flow_layout_get_property;
 
@@ -1493,6 +5910,52 @@ static void gnui_flow_layout_class_init (
 		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
 	);
 
+	flow_layout_props[FLOW_LAYOUT_PROPERTY_POSITIONAL_CLASSES] =
+		g_param_spec_boolean(
+			"positional-classes",
+			"gboolean",
+			"Whether the children get the \342\200\234left\342\200\235, "
+				"\342\200\234top\342\200\235, \342\200\234right\342\200\235 "
+				"and \342\200\234bottom\342\200\235 CSS classes when they "
+				"touch the corresponding edge of the flow",
+			true,
+			G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+		);
+
+	flow_layout_props[FLOW_LAYOUT_PROPERTY_ROW_ALIGN] = g_param_spec_enum(
+		"row-align",
+		"GtkAlign",
+		"The alignment of the children perpendicularly to the "
+			"\342\200\234orientation\342\200\235 axis within their row; "
+			"\342\200\234GTK_ALIGN_BASELINE\342\200\235 aligns the baselines "
+			"of horizontal flows, \342\200\234GTK_ALIGN_FILL\342\200\235 "
+			"stretches the children to the size of the row",
+		GTK_TYPE_ALIGN,
+		GTK_ALIGN_FILL,
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
+	flow_layout_props[FLOW_LAYOUT_PROPERTY_PACKING] = g_param_spec_enum(
+		"packing",
+		"GnuiFlowPacking",
+		"The strategy used for packing the children: in rows that are as "
+			"thick as their thickest child (broken greedily or so as to "
+			"balance the space left), or as masonry, in lanes as large as the "
+			"largest child",
+		GNUI_TYPE_FLOW_PACKING,
+		GNUI_FLOW_PACKING_GREEDY,
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
+	flow_layout_props[FLOW_LAYOUT_PROPERTY_HOMOGENEOUS] = g_param_spec_boolean(
+		"homogeneous",
+		"gboolean",
+		"Whether all the children get cells of the same size, decided by "
+			"measuring only the first few children",
+		false,
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
 	g_object_class_install_properties(
 		object_class,
 		N_FLOW_LAYOUT_PROPERTIES,
@@ -1502,33 +5965,140 @@ static void gnui_flow_layout_class_init (
 }
 
 
+/**
+
+    gnui_flow_child_layout_dispose:
+    @object:    (auto) (not nullable): The flow child layout manager passed as
+                `GObject`
+
+    Class handler for the #Object.dispose() method on the flow child layout
+    manager instance
+
+**/
+static void gnui_flow_child_layout_dispose (
+	GObject * const object
+) {
+
+	GnuiFlowChildLayoutPrivate * const chinfo =
+		gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(object)
+		);
+
+	GtkLayoutManager * const manager =
+		gtk_layout_child_get_layout_manager(GTK_LAYOUT_CHILD(object));
+
+	if (manager && chinfo->child) {
+
+		/*  The row index does not own the children: forget this one  */
+
+		GArray * const indexed_children = (
+			(GnuiFlowLayoutPrivate *)
+				gnui_flow_layout_get_instance_private(
+					GNUI_FLOW_LAYOUT(manager)
+				)
+		)->indexed_children;
+
+		if (
+			chinfo->indexed_slot < indexed_children->len &&
+			g_array_index(
+				indexed_children,
+				GnuiFlowIndexedChild,
+				chinfo->indexed_slot
+			).child == chinfo->child
+		) {
+
+			g_array_index(
+				indexed_children,
+				GnuiFlowIndexedChild,
+				chinfo->indexed_slot
+			).child = NULL;
+
+		}
+
+	}
+
+	G_OBJECT_CLASS(gnui_flow_child_layout_parent_class)->dispose(object);
+
+}
+
+
+/**
+
+    gnui_flow_child_layout_finalize:
+    @object:    (auto) (not nullable): The flow child layout manager passed as
+                `GObject`
+
+    Class handler for the #Object.finalize() method on the flow child layout
+    manager instance
+
+**/
+static void gnui_flow_child_layout_finalize (
+	GObject * const object
+) {
+
+	GnuiFlowChildLayoutPrivate * const chinfo =
+		gnui_flow_child_layout_get_instance_private(
+			GNUI_FLOW_CHILD_LAYOUT(object)
+		);
+
+	/*  The child is leaving the flow: keep the index of the children exact  */
+	if (chinfo->index_iter) {
+
+		g_sequence_remove(chinfo->index_iter);
+
+	}
+
+	G_OBJECT_CLASS(gnui_flow_child_layout_parent_class)->finalize(object);
+
+}
+
+
 /**
 
     gnui_flow_child_layout_class_init:
-    @klass:     (auto) (unused): The `GObject` klass
+    @klass:     (auto) (not nullable): The `GObject` klass
 
     The init function of the flow child layout manager class
 
 **/
 static void gnui_flow_child_layout_class_init (
-	GnuiFlowChildLayoutClass * const klass G_GNUC_UNUSED
+	GnuiFlowChildLayoutClass * const klass
 ) {
 
+	G_OBJECT_CLASS(klass)->dispose = gnui_flow_child_layout_dispose;
+	G_OBJECT_CLASS(klass)->finalize = gnui_flow_child_layout_finalize;
+
 }
 
 
 /**
 
     gnui_flow_layout_init:
-    @self:      (auto) (unused): The newly allocated flow layout manager
+    @self:      (auto) (not nullable): The newly allocated flow layout manager
 
     The init function of the flow layout manager instance
 
 **/
 static void gnui_flow_layout_init (
-	GnuiFlowLayout * const self G_GNUC_UNUSED
+	GnuiFlowLayout * const self
 ) {
 
+	GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(self);
+
+	priv->indexed_rows = g_array_new(false, false, sizeof(GnuiFlowIndexedRow));
+
+	priv->indexed_children = g_array_new(
+		false,
+		false,
+		sizeof(GnuiFlowIndexedChild)
+	);
+
+	priv->breakpoints = g_array_new(false, false, sizeof(GnuiFlowBreakpoint));
+
+	priv->positional_classes = true;
+	gnui_flow_layout_invalidate_requisitions(priv);
+
 }
 
 
@@ -1565,12 +6135,18 @@ static void gnui_flow_dispose (
 
 	GtkWidget * child;
 
+	gnui_flow_model_unbind(GNUI_FLOW(object));
+
 	while ((child = gtk_widget_get_first_child(GTK_WIDGET(object)))) {
 
 		gtk_widget_unparent(child);
 
 	}
 
+	gnui_flow_children_index_drop(
+		gnui_flow_get_instance_private(GNUI_FLOW(object))
+	);
+
 	G_OBJECT_CLASS(gnui_flow_parent_class)->dispose(object);
 
 }
@@ -1664,6 +6240,26 @@ static void gnui_flow_get_property (
 			g_value_set_enum(value, layout->line_justify);
 			return;
 
+		case FLOW_PROPERTY_POSITIONAL_CLASSES:
+
+			g_value_set_boolean(value, layout->positional_classes);
+			return;
+
+		case FLOW_PROPERTY_ROW_ALIGN:
+
+			g_value_set_enum(value, layout->row_align);
+			return;
+
+		case FLOW_PROPERTY_PACKING:
+
+			g_value_set_enum(value, layout->packing);
+			return;
+
+		case FLOW_PROPERTY_HOMOGENEOUS:
+
+			g_value_set_boolean(value, layout->homogeneous);
+			return;
+
 		case FLOW_PROPERTY_SPACING:
 
 			g_value_set_int(value, layout->spacing);
@@ -1784,6 +6380,53 @@ static void gnui_flow_set_property (
 			m_prop_id = FLOW_LAYOUT_PROPERTY_LINE_JUSTIFY;
 			break;
 
+		case FLOW_PROPERTY_POSITIONAL_CLASSES:
+
+			gnui_flow_layout_update_positional_classes(
+				GNUI_FLOW_LAYOUT(manager),
+				GTK_WIDGET(object),
+				g_value_get_boolean(value)
+			);
+
+			/*  Keep `return` here!  */
+			return;
+
+		case FLOW_PROPERTY_ROW_ALIGN:
+
+			if (layout->row_align == (val.u = g_value_get_enum(value))) {
+
+				return;
+
+			}
+
+			layout->row_align = val.u;
+			m_prop_id = FLOW_LAYOUT_PROPERTY_ROW_ALIGN;
+			break;
+
+		case FLOW_PROPERTY_PACKING:
+
+			if (layout->packing == (val.u = g_value_get_enum(value))) {
+
+				return;
+
+			}
+
+			layout->packing = val.u;
+			m_prop_id = FLOW_LAYOUT_PROPERTY_PACKING;
+			break;
+
+		case FLOW_PROPERTY_HOMOGENEOUS:
+
+			if (layout->homogeneous == (val.u = g_value_get_boolean(value))) {
+
+				return;
+
+			}
+
+			layout->homogeneous = val.u;
+			m_prop_id = FLOW_LAYOUT_PROPERTY_HOMOGENEOUS;
+			break;
+
 		case FLOW_PROPERTY_SPACING:
 
 			if (layout->spacing == (val.d = g_value_get_int(value))) {
@@ -1876,6 +6519,26 @@ void gnui_flow__on_manager_property_changed (
 			w_prop_id = FLOW_PROPERTY_LINE_JUSTIFY;
 			break;
 
+		case FLOW_LAYOUT_PROPERTY_POSITIONAL_CLASSES:
+
+			w_prop_id = FLOW_PROPERTY_POSITIONAL_CLASSES;
+			break;
+
+		case FLOW_LAYOUT_PROPERTY_ROW_ALIGN:
+
+			w_prop_id = FLOW_PROPERTY_ROW_ALIGN;
+			break;
+
+		case FLOW_LAYOUT_PROPERTY_PACKING:
+
+			w_prop_id = FLOW_PROPERTY_PACKING;
+			break;
+
+		case FLOW_LAYOUT_PROPERTY_HOMOGENEOUS:
+
+			w_prop_id = FLOW_PROPERTY_HOMOGENEOUS;
+			break;
+
 		case FLOW_LAYOUT_PROPERTY_SPACING:
 
 			w_prop_id = FLOW_PROPERTY_SPACING;
@@ -1983,6 +6646,51 @@ static void gnui_flow_class_init (
 		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
 	);
 
+	flow_props[FLOW_PROPERTY_POSITIONAL_CLASSES] = g_param_spec_boolean(
+		"positional-classes",
+		"gboolean",
+		"Whether the children get the \342\200\234left\342\200\235, "
+			"\342\200\234top\342\200\235, \342\200\234right\342\200\235 and "
+			"\342\200\234bottom\342\200\235 CSS classes when they touch the "
+			"corresponding edge of the flow",
+		true,
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
+	flow_props[FLOW_PROPERTY_ROW_ALIGN] = g_param_spec_enum(
+		"row-align",
+		"GtkAlign",
+		"The alignment of the children perpendicularly to the "
+			"\342\200\234orientation\342\200\235 axis within their row; "
+			"\342\200\234GTK_ALIGN_BASELINE\342\200\235 aligns the baselines "
+			"of horizontal flows, \342\200\234GTK_ALIGN_FILL\342\200\235 "
+			"stretches the children to the size of the row",
+		GTK_TYPE_ALIGN,
+		GTK_ALIGN_FILL,
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
+	flow_props[FLOW_PROPERTY_PACKING] = g_param_spec_enum(
+		"packing",
+		"GnuiFlowPacking",
+		"The strategy used for packing the children: in rows that are as "
+			"thick as their thickest child (broken greedily or so as to "
+			"balance the space left), or as masonry, in lanes as large as the "
+			"largest child",
+		GNUI_TYPE_FLOW_PACKING,
+		GNUI_FLOW_PACKING_GREEDY,
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
+	flow_props[FLOW_PROPERTY_HOMOGENEOUS] = g_param_spec_boolean(
+		"homogeneous",
+		"gboolean",
+		"Whether all the children get cells of the same size, decided by "
+			"measuring only the first few children",
+		false,
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
 	g_object_class_install_properties(
 		object_class,
 		N_FLOW_PROPERTIES,
@@ -2087,327 +6795,847 @@ static void gnui_flow_buildable_init (
 \*/
 
 
-/*  GnuiFlowLayout  */
+/*  GnuiFlowLayout  */
+
+
+GType gnui_flow_packing_get_type (void) {
+
+	static gsize flow_packing_type = 0;
+
+	if (g_once_init_enter(&flow_packing_type)) {
+
+		static const GEnumValue values[] = {
+			{
+				GNUI_FLOW_PACKING_GREEDY,
+				"GNUI_FLOW_PACKING_GREEDY",
+				"greedy"
+			},
+			{
+				GNUI_FLOW_PACKING_MASONRY,
+				"GNUI_FLOW_PACKING_MASONRY",
+				"masonry"
+			},
+			{
+				GNUI_FLOW_PACKING_BALANCED,
+				"GNUI_FLOW_PACKING_BALANCED",
+				"balanced"
+			},
+			{ 0, NULL, NULL }
+		};
+
+		g_once_init_leave(
+			&flow_packing_type,
+			g_enum_register_static(
+				g_intern_static_string("GnuiFlowPacking"),
+				values
+			)
+		);
+
+	}
+
+	return flow_packing_type;
+
+}
+
+
+gint gnui_flow_layout_get_spacing (
+	GnuiFlowLayout * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), 0);
+
+	return (
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->spacing;
+
+}
+
+
+void gnui_flow_layout_set_spacing (
+	GnuiFlowLayout * const self,
+	const gint spacing
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+
+	gint * const current = &(
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->spacing;
+
+	if (*current == spacing) {
+
+		return;
+
+	}
+
+	*current = spacing;
+	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
+
+	g_object_notify_by_pspec(
+		G_OBJECT(self),
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_SPACING]
+	);
+
+}
+
+
+gint gnui_flow_layout_get_leading (
+	GnuiFlowLayout * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), 0);
+
+	return (
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->leading;
+
+}
+
+
+void gnui_flow_layout_set_leading (
+	GnuiFlowLayout * const self,
+	const gint leading
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+
+	gint * const current = &(
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->leading;
+
+	if (*current == leading) {
+
+		return;
+
+	}
+
+	*current = leading;
+	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
+
+	g_object_notify_by_pspec(
+		G_OBJECT(self),
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_LEADING]
+	);
+
+}
+
+
+GtkTextDirection gnui_flow_layout_get_page_direction (
+	GnuiFlowLayout * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_TEXT_DIR_NONE);
+
+	return (
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->page_direction;
+
+}
+
+
+void gnui_flow_layout_set_page_direction (
+	GnuiFlowLayout * const self,
+	const GtkTextDirection direction
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+
+	GtkTextDirection * const current = &(
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->page_direction;
+
+	if (*current == direction) {
+
+		return;
+
+	}
+
+	*current = direction;
+	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
+
+	g_object_notify_by_pspec(
+		G_OBJECT(self),
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_PAGE_DIRECTION]
+	);
+
+}
+
+
+GtkJustification gnui_flow_layout_get_page_justify (
+	GnuiFlowLayout * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_JUSTIFY_LEFT);
+
+	return (
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->page_justify;
+
+}
+
+
+void gnui_flow_layout_set_page_justify (
+	GnuiFlowLayout * const self,
+	const GtkJustification justification
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+
+	GtkJustification * const current = &(
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->page_justify;
+
+	if (*current == justification) {
+
+		return;
+
+	}
+
+	*current = justification;
+	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
+
+	g_object_notify_by_pspec(
+		G_OBJECT(self),
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_PAGE_JUSTIFY]
+	);
+
+}
+
+
+GtkOrientation gnui_flow_layout_get_orientation (
+	GnuiFlowLayout * const self
+) {
+
+	g_return_val_if_fail(
+		GNUI_IS_FLOW_LAYOUT(self),
+		GTK_ORIENTATION_HORIZONTAL
+	);
+
+	return (
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->orientation;
+
+}
+
+
+void gnui_flow_layout_set_orientation (
+	GnuiFlowLayout * const self,
+	const GtkOrientation orientation
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+
+	gnui_flow_layout_update_orientation(
+		GNUI_FLOW_LAYOUT(gtk_widget_get_layout_manager(GTK_WIDGET(self))),
+		GTK_WIDGET(self),
+		orientation
+	);
+
+}
+
+
+GtkTextDirection gnui_flow_layout_get_line_direction (
+	GnuiFlowLayout * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_TEXT_DIR_NONE);
+
+	return (
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->line_direction;
+
+}
+
+
+void gnui_flow_layout_set_line_direction (
+	GnuiFlowLayout * const self,
+	const GtkTextDirection direction
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+
+	GtkTextDirection * const current = &(
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->line_direction;
+
+	if (*current == direction) {
+
+		return;
+
+	}
+
+	*current = direction;
+	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
+
+	g_object_notify_by_pspec(
+		G_OBJECT(self),
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_LINE_DIRECTION]
+	);
+
+}
 
 
-gint gnui_flow_layout_get_spacing (
+GtkJustification gnui_flow_layout_get_line_justify (
 	GnuiFlowLayout * const self
 ) {
 
-	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), 0);
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_JUSTIFY_LEFT);
 
 	return (
 		(GnuiFlowLayoutPrivate *)
 			gnui_flow_layout_get_instance_private(self)
-	)->spacing;
+	)->line_justify;
 
 }
 
 
-void gnui_flow_layout_set_spacing (
+void gnui_flow_layout_set_line_justify (
 	GnuiFlowLayout * const self,
-	const gint spacing
+	const GtkJustification justification
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
 
-	gint * const current = &(
+	GtkJustification * const current = &(
 		(GnuiFlowLayoutPrivate *)
 			gnui_flow_layout_get_instance_private(self)
-	)->spacing;
+	)->line_justify;
 
-	if (*current == spacing) {
+	if (*current == justification) {
 
 		return;
 
 	}
 
-	*current = spacing;
+	*current = justification;
 	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
 
 	g_object_notify_by_pspec(
 		G_OBJECT(self),
-		flow_layout_props[FLOW_LAYOUT_PROPERTY_SPACING]
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_LINE_JUSTIFY]
 	);
 
 }
 
 
-gint gnui_flow_layout_get_leading (
+gboolean gnui_flow_layout_get_positional_classes (
 	GnuiFlowLayout * const self
 ) {
 
-	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), 0);
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), false);
 
 	return (
 		(GnuiFlowLayoutPrivate *)
 			gnui_flow_layout_get_instance_private(self)
-	)->leading;
+	)->positional_classes;
 
 }
 
 
-void gnui_flow_layout_set_leading (
+void gnui_flow_layout_set_positional_classes (
 	GnuiFlowLayout * const self,
-	const gint leading
+	const gboolean enabled
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
 
-	gint * const current = &(
+	gnui_flow_layout_update_positional_classes(
+		self,
+		gtk_layout_manager_get_widget(GTK_LAYOUT_MANAGER(self)),
+		enabled
+	);
+
+}
+
+
+GtkAlign gnui_flow_layout_get_row_align (
+	GnuiFlowLayout * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_ALIGN_FILL);
+
+	return (
 		(GnuiFlowLayoutPrivate *)
 			gnui_flow_layout_get_instance_private(self)
-	)->leading;
+	)->row_align;
 
-	if (*current == leading) {
+}
+
+
+void gnui_flow_layout_set_row_align (
+	GnuiFlowLayout * const self,
+	const GtkAlign alignment
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+
+	GtkAlign * const current = &(
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(self)
+	)->row_align;
+
+	if (*current == alignment) {
 
 		return;
 
 	}
 
-	*current = leading;
+	*current = alignment;
 	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
 
 	g_object_notify_by_pspec(
 		G_OBJECT(self),
-		flow_layout_props[FLOW_LAYOUT_PROPERTY_LEADING]
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_ROW_ALIGN]
 	);
 
 }
 
 
-GtkTextDirection gnui_flow_layout_get_page_direction (
+GnuiFlowPacking gnui_flow_layout_get_packing (
 	GnuiFlowLayout * const self
 ) {
 
-	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_TEXT_DIR_NONE);
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GNUI_FLOW_PACKING_GREEDY);
 
 	return (
 		(GnuiFlowLayoutPrivate *)
 			gnui_flow_layout_get_instance_private(self)
-	)->page_direction;
+	)->packing;
 
 }
 
 
-void gnui_flow_layout_set_page_direction (
+void gnui_flow_layout_set_packing (
 	GnuiFlowLayout * const self,
-	const GtkTextDirection direction
+	const GnuiFlowPacking packing
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
 
-	GtkTextDirection * const current = &(
+	GnuiFlowPacking * const current = &(
 		(GnuiFlowLayoutPrivate *)
 			gnui_flow_layout_get_instance_private(self)
-	)->page_direction;
+	)->packing;
 
-	if (*current == direction) {
+	if (*current == packing) {
 
 		return;
 
 	}
 
-	*current = direction;
+	*current = packing;
 	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
 
 	g_object_notify_by_pspec(
 		G_OBJECT(self),
-		flow_layout_props[FLOW_LAYOUT_PROPERTY_PAGE_DIRECTION]
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_PACKING]
 	);
 
 }
 
 
-GtkJustification gnui_flow_layout_get_page_justify (
+gboolean gnui_flow_layout_get_homogeneous (
 	GnuiFlowLayout * const self
 ) {
 
-	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_JUSTIFY_LEFT);
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), false);
 
 	return (
 		(GnuiFlowLayoutPrivate *)
 			gnui_flow_layout_get_instance_private(self)
-	)->page_justify;
+	)->homogeneous;
 
 }
 
 
-void gnui_flow_layout_set_page_justify (
+void gnui_flow_layout_set_homogeneous (
 	GnuiFlowLayout * const self,
-	const GtkJustification justification
+	const gboolean homogeneous
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
 
-	GtkJustification * const current = &(
-		(GnuiFlowLayoutPrivate *)
-			gnui_flow_layout_get_instance_private(self)
-	)->page_justify;
+	GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(self);
 
-	if (*current == justification) {
+	if (priv->homogeneous == (bool) homogeneous) {
 
 		return;
 
 	}
 
-	*current = justification;
+	priv->homogeneous = homogeneous;
 	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
 
 	g_object_notify_by_pspec(
 		G_OBJECT(self),
-		flow_layout_props[FLOW_LAYOUT_PROPERTY_PAGE_JUSTIFY]
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_HOMOGENEOUS]
 	);
 
 }
 
 
-GtkOrientation gnui_flow_layout_get_orientation (
-	GnuiFlowLayout * const self
-) {
+G_GNUC_WARN_UNUSED_RESULT GtkLayoutManager * gnui_flow_layout_new (void) {
 
-	g_return_val_if_fail(
-		GNUI_IS_FLOW_LAYOUT(self),
-		GTK_ORIENTATION_HORIZONTAL
+	return g_object_new(
+		GNUI_TYPE_FLOW_LAYOUT,
+		NULL
 	);
 
-	return (
-		(GnuiFlowLayoutPrivate *)
-			gnui_flow_layout_get_instance_private(self)
-	)->orientation;
-
 }
 
 
-void gnui_flow_layout_set_orientation (
+gint gnui_flow_layout_get_index_at_pos (
 	GnuiFlowLayout * const self,
-	const GtkOrientation orientation
+	const gint x,
+	const gint y
 ) {
 
-	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), -1);
 
-	gnui_flow_layout_update_orientation(
-		GNUI_FLOW_LAYOUT(gtk_widget_get_layout_manager(GTK_WIDGET(self))),
-		GTK_WIDGET(self),
-		orientation
-	);
+	const GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(self);
+
+	GtkWidget * const widget =
+		gtk_layout_manager_get_widget(GTK_LAYOUT_MANAGER(self));
+
+	if (GNUI_IS_FLOW(widget) && gnui_flow_has_model(GNUI_FLOW(widget))) {
+
+		/*  Flows bound to a model are always packed in rows  */
+
+		const bool is_vertical =
+			priv->indexed_flags & GNUI_ORIENTABLE_POSITION_FLAG_IS_VERTICAL;
+
+		const gint row_idx =
+			gnui_flow_layout_find_indexed_row(priv, is_vertical ? x : y);
+
+		return
+			row_idx < 0 ?
+				-1
+			:
+				gnui_flow_model_locate_item(
+					gnui_flow_get_instance_private(GNUI_FLOW(widget)),
+					priv,
+					row_idx,
+					G_MAXUINT,
+					is_vertical ? y : x,
+					NULL
+				);
+
+	}
+
+	const gint slot = gnui_flow_layout_find_indexed_slot(priv, x, y);
+
+	if (slot < 0) {
+
+		return -1;
+
+	}
+
+	GtkWidget * const child = g_array_index(
+		priv->indexed_children,
+		GnuiFlowIndexedChild,
+		slot
+	).child;
+
+	/*  The child might have been removed after the last allocation  */
+	return
+		child && widget && gtk_widget_get_parent(child) == widget ?
+			gnui_flow_layout_get_position_of_child(widget, child)
+		:
+			-1;
 
 }
 
 
-GtkTextDirection gnui_flow_layout_get_line_direction (
-	GnuiFlowLayout * const self
+GtkWidget * gnui_flow_layout_get_child_at_pos (
+	GnuiFlowLayout * const self,
+	const gint x,
+	const gint y
 ) {
 
-	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_TEXT_DIR_NONE);
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), NULL);
 
-	return (
-		(GnuiFlowLayoutPrivate *)
-			gnui_flow_layout_get_instance_private(self)
-	)->line_direction;
+	GtkWidget * const widget =
+		gtk_layout_manager_get_widget(GTK_LAYOUT_MANAGER(self));
+
+	if (GNUI_IS_FLOW(widget) && gnui_flow_has_model(GNUI_FLOW(widget))) {
+
+		const gint index = gnui_flow_layout_get_index_at_pos(self, x, y);
+
+		return
+			index < 0 ?
+				NULL
+			:
+				g_array_index(
+					(
+						(GnuiFlowPrivate *)
+							gnui_flow_get_instance_private(GNUI_FLOW(widget))
+					)->items,
+					GnuiFlowModelItem,
+					index
+				).widget;
+
+	}
+
+	const GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(self);
+
+	const gint slot = gnui_flow_layout_find_indexed_slot(priv, x, y);
+
+	if (slot < 0) {
+
+		return NULL;
+
+	}
+
+	GtkWidget * const child = g_array_index(
+		priv->indexed_children,
+		GnuiFlowIndexedChild,
+		slot
+	).child;
+
+	/*  The child might have been removed after the last allocation  */
+	return
+		child && widget && gtk_widget_get_parent(child) == widget ?
+			child
+		:
+			NULL;
 
 }
 
 
-void gnui_flow_layout_set_line_direction (
+gboolean gnui_flow_layout_get_child_rect (
 	GnuiFlowLayout * const self,
-	const GtkTextDirection direction
+	const guint index,
+	GdkRectangle * const rect
 ) {
 
-	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), false);
 
-	GtkTextDirection * const current = &(
-		(GnuiFlowLayoutPrivate *)
-			gnui_flow_layout_get_instance_private(self)
-	)->line_direction;
+	const GnuiFlowLayoutPrivate * const priv =
+		gnui_flow_layout_get_instance_private(self);
 
-	if (*current == direction) {
+	GtkWidget * const widget =
+		gtk_layout_manager_get_widget(GTK_LAYOUT_MANAGER(self));
 
-		return;
+	if (GNUI_IS_FLOW(widget) && gnui_flow_has_model(GNUI_FLOW(widget))) {
+
+		guint middle, lower = 0, upper = priv->indexed_rows->len;
+
+		/*  Find the last row that begins before @index  */
+		while (lower < upper) {
+
+			middle = lower + (upper - lower) / 2;
+
+			if (
+				g_array_index(
+					priv->indexed_rows,
+					GnuiFlowIndexedRow,
+					middle
+				).first_child > index
+			) {
+
+				upper = middle;
+
+			} else {
+
+				lower = middle + 1;
+
+			}
+
+		}
+
+		return lower > 0 && gnui_flow_model_locate_item(
+			gnui_flow_get_instance_private(GNUI_FLOW(widget)),
+			priv,
+			lower - 1,
+			index,
+			0,
+			rect
+		) > -1;
 
 	}
 
-	*current = direction;
-	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
+	GtkWidget * const child =
+		widget ? gnui_flow_layout_get_nth_child(widget, index) : NULL;
 
-	g_object_notify_by_pspec(
-		G_OBJECT(self),
-		flow_layout_props[FLOW_LAYOUT_PROPERTY_LINE_DIRECTION]
-	);
+	const GnuiFlowIndexedChild * const entry =
+		child ?
+			gnui_flow_layout_lookup_indexed_child(
+				GTK_LAYOUT_MANAGER(self),
+				priv,
+				child
+			)
+		:
+			NULL;
+
+	if (!entry) {
+
+		return false;
+
+	}
+
+	GNUI_SET_POINTED_VALUE_IF_GIVEN__2_1(rect, entry->allocation);
+	return true;
 
 }
 
 
-GtkJustification gnui_flow_layout_get_line_justify (
-	GnuiFlowLayout * const self
+
+/*  GnuiFlow  */
+
+
+void gnui_flow_clear (
+	GnuiFlow * const self
 ) {
 
-	g_return_val_if_fail(GNUI_IS_FLOW_LAYOUT(self), GTK_JUSTIFY_LEFT);
+	g_return_if_fail(GNUI_IS_FLOW(self));
 
-	return (
-		(GnuiFlowLayoutPrivate *)
-			gnui_flow_layout_get_instance_private(self)
-	)->line_justify;
+	GtkWidget * child;
+
+	gnui_flow_model_unbind(self);
+
+	while ((child = gtk_widget_get_first_child(GTK_WIDGET(self)))) {
+
+		gtk_widget_unparent(child);
+
+	}
 
 }
 
 
-void gnui_flow_layout_set_line_justify (
-	GnuiFlowLayout * const self,
-	const GtkJustification justification
+void gnui_flow_bind_model (
+	GnuiFlow * const self,
+	GListModel * const model,
+	const GnuiFlowCreateWidgetFunc create_widget_func,
+	const GnuiFlowBindWidgetFunc bind_widget_func,
+	const gpointer user_data,
+	const GDestroyNotify user_data_free_func
 ) {
 
-	g_return_if_fail(GNUI_IS_FLOW_LAYOUT(self));
+	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!model || G_IS_LIST_MODEL(model));
+	g_return_if_fail(!model || (create_widget_func && bind_widget_func));
 
-	GtkJustification * const current = &(
-		(GnuiFlowLayoutPrivate *)
-			gnui_flow_layout_get_instance_private(self)
-	)->line_justify;
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
 
-	if (*current == justification) {
+	gnui_flow_clear(self);
+	gnui_flow_children_index_drop(fpriv);
 
+	if (!model) {
+
+		if (user_data_free_func) {
+
+			user_data_free_func(user_data);
+
+		}
+
+		gtk_widget_queue_resize(GTK_WIDGET(self));
 		return;
 
 	}
 
-	*current = justification;
-	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(self));
+	const guint n_items = g_list_model_get_n_items(model);
 
-	g_object_notify_by_pspec(
-		G_OBJECT(self),
-		flow_layout_props[FLOW_LAYOUT_PROPERTY_LINE_JUSTIFY]
+	fpriv->model = g_object_ref(model);
+	fpriv->create_widget_func = create_widget_func;
+	fpriv->bind_widget_func = bind_widget_func;
+	fpriv->user_data = user_data;
+	fpriv->user_data_free_func = user_data_free_func;
+
+	fpriv->items = g_array_sized_new(
+		false,
+		true,
+		sizeof(GnuiFlowModelItem),
+		n_items
+	);
+
+	g_array_set_size(fpriv->items, n_items);
+	fpriv->rows = g_array_new(false, false, sizeof(GnuiFlowModelRow));
+	fpriv->pool = g_ptr_array_new();
+
+	fpriv->items_changed_handler = g_signal_connect(
+		model,
+		"items-changed",
+		G_CALLBACK(gnui_flow__on_model_items_changed),
+		self
 	);
 
+	gtk_widget_queue_resize(GTK_WIDGET(self));
+
 }
 
 
-G_GNUC_WARN_UNUSED_RESULT GtkLayoutManager * gnui_flow_layout_new (void) {
+GListModel * gnui_flow_get_model (
+	GnuiFlow * const self
+) {
 
-	return g_object_new(
-		GNUI_TYPE_FLOW_LAYOUT,
-		NULL
-	);
+	g_return_val_if_fail(GNUI_IS_FLOW(self), NULL);
+
+	return ((GnuiFlowPrivate *) gnui_flow_get_instance_private(self))->model;
 
 }
 
 
+gint gnui_flow_get_index_at_pos (
+	GnuiFlow * const self,
+	const gint x,
+	const gint y
+) {
 
-/*  GnuiFlow  */
+	g_return_val_if_fail(GNUI_IS_FLOW(self), -1);
 
+	return gnui_flow_layout_get_index_at_pos(
+		GNUI_FLOW_LAYOUT(gtk_widget_get_layout_manager(GTK_WIDGET(self))),
+		x,
+		y
+	);
 
-void gnui_flow_clear (
-	GnuiFlow * const self
+}
+
+
+GtkWidget * gnui_flow_get_child_at_pos (
+	GnuiFlow * const self,
+	const gint x,
+	const gint y
 ) {
 
-	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_val_if_fail(GNUI_IS_FLOW(self), NULL);
+
+	return gnui_flow_layout_get_child_at_pos(
+		GNUI_FLOW_LAYOUT(gtk_widget_get_layout_manager(GTK_WIDGET(self))),
+		x,
+		y
+	);
+
+}
 
-	GtkWidget * child;
 
-	while ((child = gtk_widget_get_first_child(GTK_WIDGET(self)))) {
+gboolean gnui_flow_get_child_rect (
+	GnuiFlow * const self,
+	const guint index,
+	GdkRectangle * const rect
+) {
 
-		gtk_widget_unparent(child);
+	g_return_val_if_fail(GNUI_IS_FLOW(self), false);
 
-	}
+	return gnui_flow_layout_get_child_rect(
+		GNUI_FLOW_LAYOUT(gtk_widget_get_layout_manager(GTK_WIDGET(self))),
+		index,
+		rect
+	);
 
 }
 
@@ -2418,6 +7646,7 @@ void gnui_flow_remove (
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!gnui_flow_has_model(self));
 
 	gtk_widget_unparent(child);
 
@@ -2430,9 +7659,22 @@ void gnui_flow_append (
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!gnui_flow_has_model(self));
+
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
 
 	gtk_widget_insert_before(widget, GTK_WIDGET(self), NULL);
 
+	gnui_flow_children_index_place(
+		self,
+		fpriv,
+		widget,
+		fpriv->children_index ?
+			g_sequence_get_end_iter(fpriv->children_index)
+		:
+			NULL
+	);
+
 }
 
 
@@ -2442,9 +7684,22 @@ void gnui_flow_prepend (
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!gnui_flow_has_model(self));
+
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
 
 	gtk_widget_insert_after(widget, GTK_WIDGET(self), NULL);
 
+	gnui_flow_children_index_place(
+		self,
+		fpriv,
+		widget,
+		fpriv->children_index ?
+			g_sequence_get_begin_iter(fpriv->children_index)
+		:
+			NULL
+	);
+
 }
 
 
@@ -2455,32 +7710,128 @@ void gnui_flow_insert (
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!gnui_flow_has_model(self));
 
-	gint idx = 0;
-	GtkWidget * sibling;
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
+	GSequence * index;
+	GSequenceIter * before;
+	gint position;
 
-	if (at_index < 0) {
+	lookup_position:
 
-		for (
-			sibling = gtk_widget_get_last_child(GTK_WIDGET(self));
-				sibling && --idx > at_index;
-			sibling = gtk_widget_get_prev_sibling(sibling)
-		);
+	index = gnui_flow_children_index_ensure(self, fpriv);
 
-		gtk_widget_insert_after(widget, GTK_WIDGET(self), sibling);
+	/*  A negative index counts from the end: `-1` appends  */
+	position =
+		at_index < 0 ?
+			g_sequence_get_length(index) + at_index + 1
+		:
+			at_index;
 
-	} else {
+	before = g_sequence_get_iter_at_pos(index, position > 0 ? position : 0);
 
-		for (
-			sibling = gtk_widget_get_first_child(GTK_WIDGET(self));
-				sibling && idx++ < at_index;
-			sibling = gtk_widget_get_next_sibling(sibling)
-		);
+	if (!gnui_flow_children_index_check(self, fpriv, before)) {
+
+		/*  The index was stale and has been dropped: build it again  */
+		goto lookup_position;
+
+	}
+
+	gtk_widget_insert_before(
+		widget,
+		GTK_WIDGET(self),
+		g_sequence_iter_is_end(before) ?
+			NULL
+		:
+			((GnuiFlowChildLayoutPrivate *) g_sequence_get(before))->child
+	);
+
+	gnui_flow_children_index_place(self, fpriv, widget, before);
+
+}
+
+
+GtkWidget * gnui_flow_get_child_at_index (
+	GnuiFlow * const self,
+	const gint index
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW(self), NULL);
+	g_return_val_if_fail(!gnui_flow_has_model(self), NULL);
+
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
+	GSequence * children_index;
+	GSequenceIter * iter;
+	gint position;
+
+	lookup_child:
+
+	children_index = gnui_flow_children_index_ensure(self, fpriv);
+
+	position =
+		index < 0 ?
+			g_sequence_get_length(children_index) + index
+		:
+			index;
+
+	if (position < 0) {
+
+		return NULL;
+
+	}
+
+	iter = g_sequence_get_iter_at_pos(children_index, position);
+
+	if (!gnui_flow_children_index_check(self, fpriv, iter)) {
+
+		/*  The index was stale and has been dropped: build it again  */
+		goto lookup_child;
+
+	}
+
+	return
+		g_sequence_iter_is_end(iter) ?
+			NULL
+		:
+			((GnuiFlowChildLayoutPrivate *) g_sequence_get(iter))->child;
+
+}
+
+
+gint gnui_flow_get_index_of_child (
+	GnuiFlow * const self,
+	GtkWidget * const child
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW(self), -1);
+	g_return_val_if_fail(GTK_IS_WIDGET(child), -1);
+	g_return_val_if_fail(!gnui_flow_has_model(self), -1);
+
+	if (gtk_widget_get_parent(child) != GTK_WIDGET(self)) {
+
+		return -1;
+
+	}
+
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
+	GSequenceIter * iter;
+
+	lookup_child:
 
-		gtk_widget_insert_before(widget, GTK_WIDGET(self), sibling);
+	gnui_flow_children_index_ensure(self, fpriv);
+
+	if (
+		!(iter = gnui_flow_children_index_iter_of(self, fpriv, child)) ||
+		!gnui_flow_children_index_check(self, fpriv, iter)
+	) {
+
+		/*  The index was stale and has been dropped: build it again  */
+		goto lookup_child;
 
 	}
 
+	return g_sequence_iter_get_position(iter);
+
 }
 
 
@@ -2491,14 +7842,27 @@ void gnui_flow_insert_child_before (
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!gnui_flow_has_model(self));
 
 	g_return_if_fail(
 		!next_sibling ||
 		gtk_widget_get_parent(next_sibling) == GTK_WIDGET(self)
 	);
 
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
+
 	gtk_widget_insert_before(widget, GTK_WIDGET(self), next_sibling);
 
+	gnui_flow_children_index_place(
+		self,
+		fpriv,
+		widget,
+		fpriv->children_index ?
+			gnui_flow_children_index_iter_of(self, fpriv, next_sibling)
+		:
+			NULL
+	);
+
 }
 
 
@@ -2509,14 +7873,27 @@ void gnui_flow_insert_child_after (
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!gnui_flow_has_model(self));
 
 	g_return_if_fail(
 		!previous_sibling ||
 		gtk_widget_get_parent(previous_sibling) == GTK_WIDGET(self)
 	);
 
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
+
 	gtk_widget_insert_after(widget, GTK_WIDGET(self), previous_sibling);
 
+	gnui_flow_children_index_place(
+		self,
+		fpriv,
+		widget,
+		fpriv->children_index ?
+			gnui_flow_children_index_iter_after(self, fpriv, previous_sibling)
+		:
+			NULL
+	);
+
 }
 
 
@@ -2528,10 +7905,11 @@ G_GNUC_NULL_TERMINATED void gnui_flow_populate_before (
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!gnui_flow_has_model(self));
 
 	va_list args;
 
-	gtk_widget_insert_before(widget_1, GTK_WIDGET(self), next_sibling);
+	gnui_flow_insert_child_before(self, widget_1, next_sibling);
 	va_start(args, widget_1);
 
 	for (
@@ -2540,7 +7918,7 @@ G_GNUC_NULL_TERMINATED void gnui_flow_populate_before (
 		prev = child
 	) {
 
-		gtk_widget_insert_after(child, GTK_WIDGET(self), prev);
+		gnui_flow_insert_child_after(self, child, prev);
 
 	}
 
@@ -2557,10 +7935,11 @@ G_GNUC_NULL_TERMINATED void gnui_flow_populate_after (
 ) {
 
 	g_return_if_fail(GNUI_IS_FLOW(self));
+	g_return_if_fail(!gnui_flow_has_model(self));
 
 	va_list args;
 
-	gtk_widget_insert_after(widget_1, GTK_WIDGET(self), previous_sibling);
+	gnui_flow_insert_child_after(self, widget_1, previous_sibling);
 	va_start(args, widget_1);
 
 	for (
@@ -2569,7 +7948,7 @@ G_GNUC_NULL_TERMINATED void gnui_flow_populate_after (
 		prev = child
 	) {
 
-		gtk_widget_insert_after(child, GTK_WIDGET(self), prev);
+		gnui_flow_insert_child_after(self, child, prev);
 
 	}
 
@@ -2578,6 +7957,60 @@ G_GNUC_NULL_TERMINATED void gnui_flow_populate_after (
 }
 
 
+void gnui_flow_begin_update (
+	GnuiFlow * const self
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW(self));
+
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
+
+	g_return_if_fail(fpriv->update_depth < G_MAXUINT);
+
+	if (!fpriv->update_depth++) {
+
+		/*  The first frozen allocation must look for unplaced children  */
+		fpriv->has_new_children = true;
+
+	}
+
+}
+
+
+void gnui_flow_end_update (
+	GnuiFlow * const self
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW(self));
+
+	GnuiFlowPrivate * const fpriv = gnui_flow_get_instance_private(self);
+
+	g_return_if_fail(fpriv->update_depth > 0);
+
+	if (--fpriv->update_depth == 0) {
+
+		gtk_layout_manager_layout_changed(
+			gtk_widget_get_layout_manager(GTK_WIDGET(self))
+		);
+
+	}
+
+}
+
+
+gboolean gnui_flow_is_updating (
+	GnuiFlow * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW(self), false);
+
+	return (
+		(GnuiFlowPrivate *) gnui_flow_get_instance_private(self)
+	)->update_depth > 0;
+
+}
+
+
 gint gnui_flow_get_spacing (
 	GnuiFlow * const self
 ) {
@@ -2911,6 +8344,171 @@ void gnui_flow_set_line_justify (
 }
 
 
+gboolean gnui_flow_get_positional_classes (
+	GnuiFlow * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW(self), false);
+
+	return (
+		(GnuiFlowLayoutPrivate *) gnui_flow_layout_get_instance_private(
+			GNUI_FLOW_LAYOUT(
+				gtk_widget_get_layout_manager(GTK_WIDGET(self))
+			)
+		)
+	)->positional_classes;
+
+}
+
+
+void gnui_flow_set_positional_classes (
+	GnuiFlow * const self,
+	const gboolean enabled
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW(self));
+
+	gnui_flow_layout_update_positional_classes(
+		GNUI_FLOW_LAYOUT(gtk_widget_get_layout_manager(GTK_WIDGET(self))),
+		GTK_WIDGET(self),
+		enabled
+	);
+
+}
+
+
+GtkAlign gnui_flow_get_row_align (
+	GnuiFlow * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW(self), GTK_ALIGN_FILL);
+
+	return (
+		(GnuiFlowLayoutPrivate *) gnui_flow_layout_get_instance_private(
+			GNUI_FLOW_LAYOUT(
+				gtk_widget_get_layout_manager(GTK_WIDGET(self))
+			)
+		)
+	)->row_align;
+
+}
+
+
+void gnui_flow_set_row_align (
+	GnuiFlow * const self,
+	const GtkAlign alignment
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW(self));
+
+	GnuiFlowLayout * const manager = GNUI_FLOW_LAYOUT(
+		gtk_widget_get_layout_manager(GTK_WIDGET(self))
+	);
+
+	GtkAlign * const current = &(
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(manager)
+	)->row_align;
+
+	if (*current == alignment) {
+
+		return;
+
+	}
+
+	*current = alignment;
+	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(manager));
+
+	g_object_notify_by_pspec(
+		G_OBJECT(manager),
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_ROW_ALIGN]
+	);
+
+}
+
+
+GnuiFlowPacking gnui_flow_get_packing (
+	GnuiFlow * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW(self), GNUI_FLOW_PACKING_GREEDY);
+
+	return (
+		(GnuiFlowLayoutPrivate *) gnui_flow_layout_get_instance_private(
+			GNUI_FLOW_LAYOUT(
+				gtk_widget_get_layout_manager(GTK_WIDGET(self))
+			)
+		)
+	)->packing;
+
+}
+
+
+void gnui_flow_set_packing (
+	GnuiFlow * const self,
+	const GnuiFlowPacking packing
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW(self));
+
+	GnuiFlowLayout * const manager = GNUI_FLOW_LAYOUT(
+		gtk_widget_get_layout_manager(GTK_WIDGET(self))
+	);
+
+	GnuiFlowPacking * const current = &(
+		(GnuiFlowLayoutPrivate *)
+			gnui_flow_layout_get_instance_private(manager)
+	)->packing;
+
+	if (*current == packing) {
+
+		return;
+
+	}
+
+	*current = packing;
+	gtk_layout_manager_layout_changed(GTK_LAYOUT_MANAGER(manager));
+
+	g_object_notify_by_pspec(
+		G_OBJECT(manager),
+		flow_layout_props[FLOW_LAYOUT_PROPERTY_PACKING]
+	);
+
+}
+
+
+gboolean gnui_flow_get_homogeneous (
+	GnuiFlow * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_FLOW(self), false);
+
+	return (
+		(GnuiFlowLayoutPrivate *) gnui_flow_layout_get_instance_private(
+			GNUI_FLOW_LAYOUT(
+				gtk_widget_get_layout_manager(GTK_WIDGET(self))
+			)
+		)
+	)->homogeneous;
+
+}
+
+
+void gnui_flow_set_homogeneous (
+	GnuiFlow * const self,
+	const gboolean homogeneous
+) {
+
+	g_return_if_fail(GNUI_IS_FLOW(self));
+
+	gnui_flow_layout_set_homogeneous(
+		GNUI_FLOW_LAYOUT(gtk_widget_get_layout_manager(GTK_WIDGET(self))),
+		homogeneous
+	);
+
+}
+
+
 G_GNUC_WARN_UNUSED_RESULT GtkWidget * gnui_flow_new (void) {
 
 	return g_object_new(GNUI_TYPE_FLOW, NULL);
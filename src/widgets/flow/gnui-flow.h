@@ -95,6 +95,51 @@ struct _GnuiFlowClass {
 };
 
 
+/**
+
+    GnuiFlowCreateWidgetFunc:
+    @user_data: (auto) (nullable) (closure): The custom data passed to
+                `gnui_flow_bind_model()`
+
+    A function type for creating the widgets that a flow container bound to a
+    model will recycle for displaying the model's items
+
+    The widgets created do not represent any item until they are passed to the
+    `GnuiFlowBindWidgetFunc`.
+
+    Returns:    (transfer floating) (not nullable): A newly created widget
+
+**/
+typedef GtkWidget * (* GnuiFlowCreateWidgetFunc) (
+    gpointer user_data
+);
+
+
+/**
+
+    GnuiFlowBindWidgetFunc:
+    @widget:    (auto) (not nullable): A widget previously created by the
+                `GnuiFlowCreateWidgetFunc`
+    @item:      (auto) (type GObject) (not nullable) (transfer none): The
+                model's item that @widget must display
+    @user_data: (auto) (nullable) (closure): The custom data passed to
+                `gnui_flow_bind_model()`
+
+    A function type for updating a recycled widget so that it displays a
+    model's item
+
+    The same widget can be bound to different items many times during its
+    life, therefore the bind function must entirely overwrite whatever the
+    previous item had set.
+
+**/
+typedef void (* GnuiFlowBindWidgetFunc) (
+    GtkWidget * widget,
+    gpointer item,
+    gpointer user_data
+);
+
+
 /**
 
     gnui_flow_new:
@@ -223,6 +268,16 @@ extern void gnui_flow_remove (
 
     Insert a widget as the nth child of a flow container
 
+    The flow container keeps an index of its children, so that reaching
+    @at_index costs O(log n) instead of a walk through the children's layout
+    data; before each use the index is checked in O(1) against the first and
+    the last children and against the siblings of the position reached, and it
+    is rebuilt if children have been added or moved directly with
+    `gtk_widget_insert_before()` and friends. A child added in this way far
+    from both the edges and the position reached is noticed at the latest by
+    the next layout pass, so children should be added through the flow
+    container whenever their indices matter.
+
 **/
 extern void gnui_flow_insert (
     GnuiFlow * const self,
@@ -231,6 +286,42 @@ extern void gnui_flow_insert (
 );
 
 
+/**
+
+    gnui_flow_get_child_at_index:
+    @self:      (not nullable): The flow container
+    @index:     The index of the child; if negative the counting will be from
+                the end, with `-1` representing the last child
+
+    Get the nth child of a flow container in O(log n)
+
+    Returns:    (transfer none) (nullable): The child at @index, or `NULL` if
+                @index is out of range
+
+**/
+extern GtkWidget * gnui_flow_get_child_at_index (
+    GnuiFlow * const self,
+    const gint index
+);
+
+
+/**
+
+    gnui_flow_get_index_of_child:
+    @self:      (not nullable): The flow container
+    @child:     (not nullable): The child to look up
+
+    Get the position of a child within a flow container in O(log n)
+
+    Returns:    The index of @child, or `-1` if @child is not a child of @self
+
+**/
+extern gint gnui_flow_get_index_of_child (
+    GnuiFlow * const self,
+    GtkWidget * const child
+);
+
+
 /**
 
     gnui_flow_insert_child_before:
@@ -269,6 +360,55 @@ extern void gnui_flow_insert_child_after (
 );
 
 
+/**
+
+    gnui_flow_begin_update:
+    @self:      (not nullable): The flow container
+
+    Start a batch of changes to the children of a flow container
+
+    Until the matching call to `gnui_flow_end_update()`, the flow container
+    keeps its size and the position of the children it has already placed,
+    children added in the meanwhile stay hidden and no positional CSS classes
+    are updated; all the changes are then laid out at once. Calls can be
+    nested: only the outermost call to `gnui_flow_end_update()` commits the
+    changes.
+
+**/
+extern void gnui_flow_begin_update (
+    GnuiFlow * const self
+);
+
+
+/**
+
+    gnui_flow_end_update:
+    @self:      (not nullable): The flow container
+
+    End a batch of changes started with `gnui_flow_begin_update()`
+
+**/
+extern void gnui_flow_end_update (
+    GnuiFlow * const self
+);
+
+
+/**
+
+    gnui_flow_is_updating:
+    @self:      (not nullable): The flow container
+
+    Check whether a batch of changes is in progress in a flow container
+
+    Returns:    `true` if `gnui_flow_begin_update()` has been called more times
+                than `gnui_flow_end_update()`, `false` otherwise
+
+**/
+extern gboolean gnui_flow_is_updating (
+    GnuiFlow * const self
+);
+
+
 /**
 
     gnui_flow_populate_before:
@@ -326,6 +466,139 @@ extern void gnui_flow_clear (
 );
 
 
+/**
+
+    gnui_flow_bind_model:
+    @self:                  (not nullable): The flow container
+    @model:                 (nullable): The `GListModel` to bind, or `NULL` for
+                            unbinding the current model
+    @create_widget_func:    (nullable): A function that creates the widgets
+                            that will be recycled for displaying the items (it
+                            can be `NULL` only if @model is `NULL`)
+    @bind_widget_func:      (nullable): A function that makes a recycled widget
+                            display a model's item (it can be `NULL` only if
+                            @model is `NULL`)
+    @user_data:             (nullable) (closure): Custom data to pass to
+                            @create_widget_func and @bind_widget_func
+    @user_data_free_func:   (nullable): A function for freeing @user_data when
+                            the model is unbound
+
+    Bind a `GListModel` to a flow container
+
+    While a model is bound, the flow container displays its items instead of
+    its children, and only the items in the rows that intersect the visible
+    area of the nearest scrollable ancestor (normally the `GtkViewport` that a
+    `GtkScrolledWindow` places around the flow container) get a widget; the
+    widgets are recycled while scrolling. If the flow container is not placed
+    inside a scrollable widget all the items are displayed.
+
+    The items that have never been displayed are assumed to be as large as the
+    average of those that have been measured, so the rows can slightly move
+    while scrolling towards items never seen before. The rows are broken again
+    only when the available size, the spacing or the leading change, and
+    otherwise only from the first item whose size (or presence in the model)
+    has changed; scrolling through items already seen only looks up the rows
+    that become visible.
+
+    Children expansion is not taken into account and a `GTK_JUSTIFY_FILL`
+    #GnuiFlow:page-justify is treated like `GTK_JUSTIFY_LEFT`.
+
+    Binding a model removes all the children of the flow container. While a
+    model is bound, children cannot be added or removed directly; calling
+    `gnui_flow_clear()` unbinds the model.
+
+**/
+extern void gnui_flow_bind_model (
+    GnuiFlow * const self,
+    GListModel * const model,
+    const GnuiFlowCreateWidgetFunc create_widget_func,
+    const GnuiFlowBindWidgetFunc bind_widget_func,
+    const gpointer user_data,
+    const GDestroyNotify user_data_free_func
+);
+
+
+/**
+
+    gnui_flow_get_model:
+    @self:      (not nullable): The flow container
+
+    Get the `GListModel` bound to a flow container
+
+    Returns:    (transfer none) (nullable): The model bound to the flow
+                container, or `NULL`
+
+**/
+extern GListModel * gnui_flow_get_model (
+    GnuiFlow * const self
+);
+
+
+/**
+
+    gnui_flow_get_index_at_pos:
+    @self:      (not nullable): The flow container
+    @x:         The horizontal coordinate, relative to @self
+    @y:         The vertical coordinate, relative to @self
+
+    Get the index of the child found at a given position during the last
+    allocation
+
+    See `gnui_flow_layout_get_index_at_pos()` for details.
+
+    Returns:    The index of the child found at the given position, or `-1` if
+                there is no child there
+
+**/
+extern gint gnui_flow_get_index_at_pos (
+    GnuiFlow * const self,
+    const gint x,
+    const gint y
+);
+
+
+/**
+
+    gnui_flow_get_child_at_pos:
+    @self:      (not nullable): The flow container
+    @x:         The horizontal coordinate, relative to @self
+    @y:         The vertical coordinate, relative to @self
+
+    Get the child found at a given position during the last allocation
+
+    Returns:    (transfer none) (nullable): The child found at the given
+                position, or `NULL` if there is no child there
+
+**/
+extern GtkWidget * gnui_flow_get_child_at_pos (
+    GnuiFlow * const self,
+    const gint x,
+    const gint y
+);
+
+
+/**
+
+    gnui_flow_get_child_rect:
+    @self:      (not nullable): The flow container
+    @index:     The index of the child (or of the model's item)
+    @rect:      (out) (optional): A pointer for saving the rectangle that the
+                child occupied during the last allocation
+
+    Get the rectangle that a child occupied during the last allocation
+
+    See `gnui_flow_layout_get_child_rect()` for details.
+
+    Returns:    `true` if @index refers to a child, `false` otherwise
+
+**/
+extern gboolean gnui_flow_get_child_rect (
+    GnuiFlow * const self,
+    const guint index,
+    GdkRectangle * const rect
+);
+
+
 /**
 
     gnui_flow_get_spacing: (get-property spacing)
@@ -539,6 +812,163 @@ extern void gnui_flow_set_line_justify (
 );
 
 
+/**
+
+    gnui_flow_get_positional_classes: (get-property positional-classes)
+    @self:      (not nullable): The flow container
+
+    Get whether the children of the flow container get positional CSS classes
+
+    Returns:    `true` if the children get the `left`, `top`, `right` and
+                `bottom` CSS classes when they touch the corresponding edge,
+                `false` otherwise
+
+**/
+extern gboolean gnui_flow_get_positional_classes (
+    GnuiFlow * const self
+);
+
+
+/**
+
+    gnui_flow_set_positional_classes: (set-property positional-classes)
+    @self:      (not nullable): The flow container
+    @enabled:   Whether the children must get positional CSS classes
+
+    Set whether the children of the flow container get the `left`, `top`,
+    `right` and `bottom` CSS classes when they touch the corresponding edge
+
+    These classes are enabled by default; disabling them removes them from all
+    the children and spares a style invalidation every time a child moves to
+    another edge, which matters in flows that are often resized and whose
+    stylesheet does not use them.
+
+**/
+extern void gnui_flow_set_positional_classes (
+    GnuiFlow * const self,
+    const gboolean enabled
+);
+
+
+/**
+
+    gnui_flow_get_row_align: (get-property row-align)
+    @self:      (not nullable): The flow widget
+
+    Get the alignment of the children within their row
+
+    Returns:    The alignment of the children perpendicularly to the
+                orientation axis
+
+**/
+extern GtkAlign gnui_flow_get_row_align (
+    GnuiFlow * const self
+);
+
+
+/**
+
+    gnui_flow_set_row_align: (set-property row-align)
+    @self:      (not nullable): The flow widget
+    @alignment: The alignment of the children perpendicularly to the
+                orientation axis
+
+    Set the alignment of the children within their row
+
+    With `GTK_ALIGN_FILL` (the default) the children are stretched to the size
+    of the row; with `GTK_ALIGN_START`, `GTK_ALIGN_CENTER` or `GTK_ALIGN_END`
+    they keep their natural size; with `GTK_ALIGN_BASELINE` the children of a
+    horizontal flow are aligned by their baselines and the rows grow as much as
+    needed to host them (children that do not report a baseline are aligned to
+    the start). Children that expand perpendicularly to the orientation axis
+    always fill their row.
+
+**/
+extern void gnui_flow_set_row_align (
+    GnuiFlow * const self,
+    const GtkAlign alignment
+);
+
+
+/**
+
+    gnui_flow_get_packing: (get-property packing)
+    @self:      (not nullable): The flow widget
+
+    Get the strategy used for packing the children
+
+    Returns:    The packing strategy
+
+**/
+extern GnuiFlowPacking gnui_flow_get_packing (
+    GnuiFlow * const self
+);
+
+
+/**
+
+    gnui_flow_set_packing: (set-property packing)
+    @self:      (not nullable): The flow widget
+    @packing:   The packing strategy
+
+    Set the strategy used for packing the children
+
+    With `GNUI_FLOW_PACKING_MASONRY` the children are placed in lanes as large
+    as the largest child, each one in the lane that is currently the shortest;
+    #GnuiFlow:line-justify decides how the lanes share the space left and
+    #GnuiFlow:leading separates the children of the same lane. With
+    `GNUI_FLOW_PACKING_BALANCED` the rows are broken as in
+    `GNUI_FLOW_PACKING_GREEDY`, except that a child can start a new row before
+    the current one is full, if this makes the rows more even (for each row
+    end only the 64 shortest candidate rows and the longest row that fits are
+    weighed, so the cost stays linear in the number of children and a row can
+    still host any number of them). Flows bound to a model are always packed
+    greedily.
+
+**/
+extern void gnui_flow_set_packing (
+    GnuiFlow * const self,
+    const GnuiFlowPacking packing
+);
+
+
+/**
+
+    gnui_flow_get_homogeneous: (get-property homogeneous)
+    @self:      (not nullable): The flow widget
+
+    Get whether all the children get cells of the same size
+
+    Returns:    `true` if the flow is homogeneous, `false` otherwise
+
+**/
+extern gboolean gnui_flow_get_homogeneous (
+    GnuiFlow * const self
+);
+
+
+/**
+
+    gnui_flow_set_homogeneous: (set-property homogeneous)
+    @self:          (not nullable): The flow widget
+    @homogeneous:   Whether all the children must get cells of the same size
+
+    Set whether all the children get cells of the same size
+
+    A homogeneous flow measures only its first few children and gives every
+    child a cell as large as the largest of them, computing the position of
+    each cell directly from the child's index; this makes resizing an icon
+    grid with thousands of identical cells cheap. Children larger than the
+    ones measured get less space than they request. A homogeneous flow is
+    always packed in a grid, whatever #GnuiFlow:packing says.
+
+**/
+extern void gnui_flow_set_homogeneous (
+    GnuiFlow * const self,
+    const gboolean homogeneous
+);
+
+
 G_END_DECLS
 
 
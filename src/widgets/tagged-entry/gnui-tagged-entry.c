@@ -48,11 +48,14 @@
 
 
 typedef struct _GnuiTaggedEntryPrivate {
-	GList * taglist;
+	GSequence * tag_sequence;
+	GHashTable * tag_index;
+	GPtrArray * tag_snapshot;
 	GtkWidget * textbox;
 	gsize tag_count;
 	gsize next_id;
-	bool tags_have_changed;
+	gsize pressed_id;
+	bool remover_pressed;
 } GnuiTaggedEntryPrivate;
 
 
@@ -63,14 +66,44 @@ typedef struct _TagReference {
 		* box,
 		* remover;
 	GtkLabel * marker;
+	GSequenceIter * iter;
 	gsize id;
 	bool pinned;
 } TagReference;
 
 
+#define GNUI_TYPE_TAG_CHIP (gnui_tag_chip_get_type())
+
+
+G_DECLARE_FINAL_TYPE(
+	GnuiTagChip,
+	gnui_tag_chip,
+	GNUI,
+	TAG_CHIP,
+	GtkWidget
+)
+
+
+struct _GnuiTagChip {
+	GtkWidget parent_instance;
+	PangoLayout * layout;
+	TagReference * tagref;
+	guint context_serial;
+	gint remover_x;
+};
+
+
+G_DEFINE_FINAL_TYPE(
+	GnuiTagChip,
+	gnui_tag_chip,
+	GTK_TYPE_WIDGET
+)
+
+
 struct _GnuiTaggedEntry {
 	GtkWidget parent_instance;
 	GnuiTaggedEntryFilterFunc filter_function;
+	GnuiTaggedEntryHashFunc hash_function;
 	GnuiTaggedEntryMatchFunc match_function;
 	GnuiTaggedEntrySanitizeFunc sanitize_function;
 	GnuiTaggedEntrySortFunc sort_function;
@@ -79,10 +112,10 @@ struct _GnuiTaggedEntry {
 	gpointer sort_data;
 	gpointer filter_data;
 	gchar * delimiter_chars;
-	gchar ** tags;
 	bool
 		modified : 1,
-		invalid : 1;
+		invalid : 1,
+		lightweight_tags : 1;
 };
 
 
@@ -113,7 +146,9 @@ enum {
 	PROPERTY_DELIMITER_CHARS,
 	PROPERTY_FILTER_DATA,
 	PROPERTY_FILTER_FUNCTION,
+	PROPERTY_HASH_FUNCTION,
 	PROPERTY_INVALID,
+	PROPERTY_LIGHTWEIGHT_TAGS,
 	PROPERTY_MATCH_DATA,
 	PROPERTY_MATCH_FUNCTION,
 	PROPERTY_MODIFIED,
@@ -138,6 +173,7 @@ enum {
 	SIGNAL_MODIFIED_CHANGED,
 	SIGNAL_TAG_ADDED,
 	SIGNAL_TAG_REMOVED,
+	SIGNAL_TAGS_ADDED,
 
 	/*  Number of signals  */
 	N_SIGNALS
@@ -159,6 +195,397 @@ static guint signals[N_SIGNALS];
 \*/
 
 
+/*  Tag chips  */
+
+
+/**
+
+    gnui_tag_chip_ensure_layout:
+    @chip:      (not nullable): The tag chip
+
+    Create the cached `PangoLayout` of a tag chip if this does not exist yet
+    and compute where its remover begins
+
+    Pinned tags are drawn without a remover.
+
+    Returns:    (transfer none): The chip's layout
+
+**/
+static PangoLayout * gnui_tag_chip_ensure_layout (
+	GnuiTagChip * const chip
+) {
+
+	if (chip->layout) {
+
+		return chip->layout;
+
+	}
+
+	chip->layout = gtk_widget_create_pango_layout(GTK_WIDGET(chip), NULL);
+
+	chip->context_serial =
+		pango_context_get_serial(pango_layout_get_context(chip->layout));
+
+	if (chip->tagref->pinned) {
+
+		pango_layout_set_text(chip->layout, chip->tagref->tag, -1);
+		chip->remover_x = G_MAXINT;
+		return chip->layout;
+
+	}
+
+	/*  The remover is an en space followed by a multiplication sign  */
+
+	gchar * const text =
+		g_strconcat(chip->tagref->tag, "\342\200\202\303\227", NULL);
+
+	PangoRectangle pos;
+
+	pango_layout_set_text(chip->layout, text, -1);
+	pango_layout_index_to_pos(chip->layout, strlen(chip->tagref->tag), &pos);
+	chip->remover_x = PANGO_PIXELS(pos.x);
+	g_free(text);
+	return chip->layout;
+
+}
+
+
+/**
+
+    gnui_tag_chip_invalidate:
+    @chip:      (not nullable): The tag chip
+
+    Drop the cached layout of a tag chip after its tag, its pin state or its
+    style have changed
+
+**/
+static void gnui_tag_chip_invalidate (
+	GnuiTagChip * const chip
+) {
+
+	g_clear_object(&chip->layout);
+	gtk_widget_queue_resize(GTK_WIDGET(chip));
+
+}
+
+
+/**
+
+    gnui_tag_chip_refresh:
+    @chip:      (not nullable): The tag chip
+
+    Update a tag chip after its tag or its pin state have changed
+
+**/
+static void gnui_tag_chip_refresh (
+	GnuiTagChip * const chip
+) {
+
+	gnui_tag_chip_invalidate(chip);
+
+	gtk_accessible_update_property(
+		GTK_ACCESSIBLE(chip),
+		GTK_ACCESSIBLE_PROPERTY_LABEL,
+		chip->tagref->tag,
+		-1
+	);
+
+	if (chip->tagref->pinned) {
+
+		gtk_accessible_reset_property(
+			GTK_ACCESSIBLE(chip),
+			GTK_ACCESSIBLE_PROPERTY_DESCRIPTION
+		);
+
+		return;
+
+	}
+
+	gtk_accessible_update_property(
+		GTK_ACCESSIBLE(chip),
+		GTK_ACCESSIBLE_PROPERTY_DESCRIPTION,
+		_("Press Delete to remove the tag"),
+		-1
+	);
+
+}
+
+
+/**
+
+    gnui_tag_chip_new:
+    @tagref:    (not nullable): The `TagReference` that the chip displays
+
+    Create a new tag chip
+
+    Returns:    The newly created tag chip
+
+**/
+static GtkWidget * gnui_tag_chip_new (
+	TagReference * const tagref
+) {
+
+	GnuiTagChip * const chip = g_object_new(GNUI_TYPE_TAG_CHIP, NULL);
+
+	chip->tagref = tagref;
+	gnui_tag_chip_refresh(chip);
+	return GTK_WIDGET(chip);
+
+}
+
+
+/**
+
+    gnui_tag_chip__on_delete_key:
+    @widget:    (auto) (not nullable): The tag chip passed as `GtkWidget`
+    @args:      (auto) (unused) (nullable): The arguments of the binding
+    @user_data: (auto) (unused) (nullable): The binding's custom data
+
+    Keyboard binding that removes the tag of a focused tag chip (the focus
+    passes to the next sibling)
+
+    Returns:    `true` if the tag has been removed, `false` otherwise
+
+**/
+static gboolean gnui_tag_chip__on_delete_key (
+	GtkWidget * const widget,
+	GVariant * const args G_GNUC_UNUSED,
+	const gpointer user_data G_GNUC_UNUSED
+) {
+
+	TagReference * const tagref = GNUI_TAG_CHIP(widget)->tagref;
+
+	if (tagref->pinned) {
+
+		return false;
+
+	}
+
+	/*  The text box is always the last child, so this is never `NULL`  */
+	GtkWidget * const next_sibling = gtk_widget_get_next_sibling(widget);
+
+	gnui_tagged_entry_remove_tag(tagref->parent, tagref->tag);
+	gtk_widget_grab_focus(next_sibling);
+	return true;
+
+}
+
+
+/**
+
+    gnui_tag_chip_measure:
+    @widget:            (auto) (not nullable): The tag chip passed as
+                        `GtkWidget`
+    @orientation:       (auto): The orientation to measure
+    @for_size:          (auto) (unused): The size in the opposite orientation
+    @minimum:           (auto) (out): The minimum size
+    @natural:           (auto) (out): The natural size
+    @minimum_baseline:  (auto) (out) (unused): The minimum baseline
+    @natural_baseline:  (auto) (out) (unused): The natural baseline
+
+    Class handler for the #GtkWidget.measure() method on the tag chip
+
+**/
+static void gnui_tag_chip_measure (
+	GtkWidget * const widget,
+	const GtkOrientation orientation,
+	const int for_size G_GNUC_UNUSED,
+	int * const minimum,
+	int * const natural,
+	int * const minimum_baseline G_GNUC_UNUSED,
+	int * const natural_baseline G_GNUC_UNUSED
+) {
+
+	int width, height;
+
+	pango_layout_get_pixel_size(
+		gnui_tag_chip_ensure_layout(GNUI_TAG_CHIP(widget)),
+		&width,
+		&height
+	);
+
+	*minimum = *natural =
+		orientation == GTK_ORIENTATION_HORIZONTAL ? width : height;
+
+}
+
+
+/**
+
+    gnui_tag_chip_snapshot:
+    @widget:    (auto) (not nullable): The tag chip passed as `GtkWidget`
+    @snapshot:  (auto) (not nullable): The snapshot to draw on
+
+    Class handler for the #GtkWidget.snapshot() method on the tag chip
+
+**/
+static void gnui_tag_chip_snapshot (
+	GtkWidget * const widget,
+	GtkSnapshot * const snapshot
+) {
+
+	PangoLayout * const layout =
+		gnui_tag_chip_ensure_layout(GNUI_TAG_CHIP(widget));
+
+	GdkRGBA color;
+	int height;
+
+	pango_layout_get_pixel_size(layout, NULL, &height);
+	gtk_widget_get_color(widget, &color);
+	gtk_snapshot_save(snapshot);
+
+	gtk_snapshot_translate(
+		snapshot,
+		&GRAPHENE_POINT_INIT(
+			0.0f,
+			(gtk_widget_get_height(widget) - height) / 2.0f
+		)
+	);
+
+	gtk_snapshot_append_layout(snapshot, layout, &color);
+	gtk_snapshot_restore(snapshot);
+
+}
+
+
+/**
+
+    gnui_tag_chip_css_changed:
+    @widget:    (auto) (not nullable): The tag chip passed as `GtkWidget`
+    @change:    (auto) (nullable): The style change
+
+    Class handler for the #GtkWidget.css_changed() method on the tag chip
+
+    Most style changes (e.g. `:hover`) leave the text untouched: the cached
+    layout is dropped only if the font or the text attributes that GTK derives
+    from the style are not the same anymore.
+
+**/
+static void gnui_tag_chip_css_changed (
+	GtkWidget * const widget,
+	GtkCssStyleChange * const change
+) {
+
+	GnuiTagChip * const chip = GNUI_TAG_CHIP(widget);
+
+	GTK_WIDGET_CLASS(gnui_tag_chip_parent_class)->css_changed(widget, change);
+
+	if (!chip->layout) {
+
+		return;
+
+	}
+
+	/*  A layout without text is cheap: nothing is shaped until measured  */
+	PangoLayout * const probe = gtk_widget_create_pango_layout(widget, NULL);
+
+	if (
+		pango_context_get_serial(pango_layout_get_context(probe)) !=
+			chip->context_serial ||
+		!pango_attr_list_equal(
+			pango_layout_get_attributes(probe),
+			pango_layout_get_attributes(chip->layout)
+		)
+	) {
+
+		gnui_tag_chip_invalidate(chip);
+
+	}
+
+	g_object_unref(probe);
+
+}
+
+
+/**
+
+    gnui_tag_chip_dispose:
+    @object:    (auto) (not nullable): The tag chip passed as `GObject`
+
+    Class handler for the #GObject.dispose() method on the tag chip
+
+**/
+static void gnui_tag_chip_dispose (
+	GObject * const object
+) {
+
+	g_clear_object(&GNUI_TAG_CHIP(object)->layout);
+	G_OBJECT_CLASS(gnui_tag_chip_parent_class)->dispose(object);
+
+}
+
+
+/**
+
+    gnui_tag_chip_class_init:
+    @klass:     (auto) (not nullable): The `GObject` klass
+
+    Class initializer of the tag chip
+
+**/
+static void gnui_tag_chip_class_init (
+	GnuiTagChipClass * const klass
+) {
+
+	GtkWidgetClass * const widget_class = GTK_WIDGET_CLASS(klass);
+
+	G_OBJECT_CLASS(klass)->dispose = gnui_tag_chip_dispose;
+	widget_class->measure = gnui_tag_chip_measure;
+	widget_class->snapshot = gnui_tag_chip_snapshot;
+	widget_class->css_changed = gnui_tag_chip_css_changed;
+	gtk_widget_class_set_css_name(widget_class, "chip");
+
+	gtk_widget_class_set_accessible_role(
+		widget_class,
+		GTK_ACCESSIBLE_ROLE_BUTTON
+	);
+
+	gtk_widget_class_add_binding(
+		widget_class,
+		GDK_KEY_Delete,
+		0,
+		gnui_tag_chip__on_delete_key,
+		NULL
+	);
+
+	gtk_widget_class_add_binding(
+		widget_class,
+		GDK_KEY_KP_Delete,
+		0,
+		gnui_tag_chip__on_delete_key,
+		NULL
+	);
+
+	gtk_widget_class_add_binding(
+		widget_class,
+		GDK_KEY_BackSpace,
+		0,
+		gnui_tag_chip__on_delete_key,
+		NULL
+	);
+
+}
+
+
+/**
+
+    gnui_tag_chip_init:
+    @chip:      (auto) (not nullable): The tag chip
+
+    Instance initializer of the tag chip
+
+**/
+static void gnui_tag_chip_init (
+	GnuiTagChip * const chip
+) {
+
+	chip->remover_x = G_MAXINT;
+	gtk_widget_set_focusable(GTK_WIDGET(chip), true);
+	gtk_widget_add_css_class(GTK_WIDGET(chip), "tag");
+
+}
+
+
 /*  Inline  */
 
 
@@ -170,6 +597,9 @@ static guint signals[N_SIGNALS];
 
     Destroy a `TagReference`
 
+    This emits #GnuiTaggedEntry::tag-removed, so the tag must already be gone
+    from the sequence, the index, the snapshot and the tag count.
+
 **/
 static inline void gnui_tagged_entry_tag_reference_destroy (
 	GnuiTaggedEntry * const self,
@@ -182,6 +612,27 @@ static inline void gnui_tagged_entry_tag_reference_destroy (
 }
 
 
+/**
+
+    gnui_tagged_entry_tag_reference_refresh:
+    @tagref:    (not nullable): The `TagReference` to refresh
+
+    Update the widgets of a `TagReference` after its tag or its pin state have
+    changed
+
+**/
+static inline void gnui_tagged_entry_tag_reference_refresh (
+	TagReference * const tagref
+) {
+	if (!tagref->marker) {
+		gnui_tag_chip_refresh(GNUI_TAG_CHIP(tagref->box));
+		return;
+	}
+	gtk_label_set_text(tagref->marker, tagref->tag);
+	gtk_widget_set_sensitive(tagref->remover, !tagref->pinned);
+}
+
+
 /**
 
     gnui_tagged_entry_dispatch_modified:
@@ -197,7 +648,6 @@ static inline void gnui_tagged_entry_dispatch_modified (
 	GnuiTaggedEntryPrivate * const priv,
 	const bool modified
 ) {
-	priv->tags_have_changed = true;
 	if (self->modified == modified) return;
 	self->modified = modified;
 	g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_MODIFIED]);
@@ -207,22 +657,219 @@ static inline void gnui_tagged_entry_dispatch_modified (
 
 /**
 
-    gnui_tagged_entry_delete_llnk:
+    gnui_tagged_entry_hash_tag:
+    @self:      (not nullable): The tagged entry
+    @tag:       (not nullable): The string to hash
+
+    Compute the hash of a string using the tagged entry's hash function if
+    this is set, or `g_str_hash()` otherwise
+
+    Returns:    The hash of @tag
+
+**/
+static inline guint gnui_tagged_entry_hash_tag (
+	GnuiTaggedEntry * const self,
+	const gchar * const tag
+) {
+	return
+		self->hash_function ?
+			self->hash_function(tag, self->match_data)
+		:
+			g_str_hash(tag);
+}
+
+
+/**
+
+    gnui_tagged_entry_index_tagref:
     @self:      (not nullable): The tagged entry
     @priv:      (not nullable): The tagged entry's private `struct`
-    @tagllnk:   (transfer full) (not nullable): The list link to delete
+    @tagref:    (not nullable): The `TagReference` to add to the index
 
-    Remove a doubly-linked link containing a `TagReference`
+    Add a `TagReference` to the tag index (if the tagged entry has one)
+
+    Tags with the same hash share a bucket; new tags are appended after the
+    bucket's head, so that the hash table never needs to be updated when a
+    bucket already exists.
+
+**/
+static inline void gnui_tagged_entry_index_tagref (
+	GnuiTaggedEntry * const self,
+	GnuiTaggedEntryPrivate * const priv,
+	TagReference * const tagref
+) {
+	if (!priv->tag_index) return;
+	const gpointer key =
+		GUINT_TO_POINTER(gnui_tagged_entry_hash_tag(self, tagref->tag));
+	GSList * const bucket = g_hash_table_lookup(priv->tag_index, key);
+	if (bucket) bucket->next = g_slist_prepend(bucket->next, tagref);
+	else g_hash_table_insert(
+		priv->tag_index,
+		key,
+		g_slist_prepend(NULL, tagref)
+	);
+}
+
+
+/**
+
+    gnui_tagged_entry_unindex_tagref:
+    @self:      (not nullable): The tagged entry
+    @priv:      (not nullable): The tagged entry's private `struct`
+    @tagref:    (not nullable): The `TagReference` to remove from the index
+
+    Remove a `TagReference` from the tag index (if the tagged entry has one)
+
+    This must be invoked before the tag string of @tagref changes.
+
+**/
+static inline void gnui_tagged_entry_unindex_tagref (
+	GnuiTaggedEntry * const self,
+	GnuiTaggedEntryPrivate * const priv,
+	TagReference * const tagref
+) {
+	if (!priv->tag_index) return;
+	const gpointer key =
+		GUINT_TO_POINTER(gnui_tagged_entry_hash_tag(self, tagref->tag));
+	GSList * const bucket = g_hash_table_lookup(priv->tag_index, key);
+	if (!bucket) return;
+	if (bucket->data != tagref) {
+		bucket->next = g_slist_remove(bucket->next, tagref);
+		return;
+	}
+	if (!bucket->next) {
+		g_hash_table_remove(priv->tag_index, key);
+		return;
+	}
+	bucket->data = bucket->next->data;
+	bucket->next = g_slist_delete_link(bucket->next, bucket->next);
+}
+
+
+/**
+
+    gnui_tagged_entry_rebuild_index:
+    @self:      (not nullable): The tagged entry
+    @priv:      (not nullable): The tagged entry's private `struct`
+
+    Discard the tag index and build it anew, if the tagged entry can have one
+
+    A tagged entry can be indexed only when it does not have a match function
+    or when it has a hash function consistent with it.
+
+**/
+static inline void gnui_tagged_entry_rebuild_index (
+	GnuiTaggedEntry * const self,
+	GnuiTaggedEntryPrivate * const priv
+) {
+	g_clear_pointer(&priv->tag_index, g_hash_table_unref);
+	if (self->match_function && !self->hash_function) return;
+	priv->tag_index = g_hash_table_new_full(
+		g_direct_hash,
+		g_direct_equal,
+		NULL,
+		(GDestroyNotify) g_slist_free
+	);
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) gnui_tagged_entry_index_tagref(self, priv, g_sequence_get(iter));
+}
+
+
+/**
+
+    gnui_tagged_entry_snapshot_insert:
+    @priv:      (not nullable): The tagged entry's private `struct`
+    @tagref:    (not nullable): The `TagReference` just placed in the sequence
+
+    Insert the tag of a `TagReference` into the tag snapshot, at the same
+    position that the `TagReference` occupies in the tag sequence
+
+    The snapshot borrows the tag strings owned by the `TagReference` objects
+    and is always terminated by `NULL`.
+
+**/
+static inline void gnui_tagged_entry_snapshot_insert (
+	GnuiTaggedEntryPrivate * const priv,
+	TagReference * const tagref
+) {
+	g_ptr_array_insert(
+		priv->tag_snapshot,
+		g_sequence_iter_get_position(tagref->iter),
+		tagref->tag
+	);
+}
+
+
+/**
+
+    gnui_tagged_entry_snapshot_remove:
+    @priv:      (not nullable): The tagged entry's private `struct`
+    @tagref:    (not nullable): The `TagReference` about to leave the sequence
+
+    Remove the tag of a `TagReference` from the tag snapshot
+
+    This must be invoked while @tagref is still in the tag sequence.
 
 **/
-static inline void gnui_tagged_entry_delete_llnk (
+static inline void gnui_tagged_entry_snapshot_remove (
+	GnuiTaggedEntryPrivate * const priv,
+	TagReference * const tagref
+) {
+	g_ptr_array_remove_index(
+		priv->tag_snapshot,
+		g_sequence_iter_get_position(tagref->iter)
+	);
+}
+
+
+/**
+
+    gnui_tagged_entry_snapshot_rebuild:
+    @priv:      (not nullable): The tagged entry's private `struct`
+
+    Fill the tag snapshot anew from the tag sequence, without copying any
+    string
+
+**/
+static inline void gnui_tagged_entry_snapshot_rebuild (
+	GnuiTaggedEntryPrivate * const priv
+) {
+	g_ptr_array_set_size(priv->tag_snapshot, 0);
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) g_ptr_array_add(
+		priv->tag_snapshot,
+		((TagReference *) g_sequence_get(iter))->tag
+	);
+	g_ptr_array_add(priv->tag_snapshot, NULL);
+}
+
+
+/**
+
+    gnui_tagged_entry_delete_tagref:
+    @self:      (not nullable): The tagged entry
+    @priv:      (not nullable): The tagged entry's private `struct`
+    @tagref:    (transfer full) (not nullable): The `TagReference` to delete
+
+    Remove a `TagReference` from the tag sequence and destroy it
+
+**/
+static inline void gnui_tagged_entry_delete_tagref (
 	GnuiTaggedEntry * const self,
 	GnuiTaggedEntryPrivate * const priv,
-	GList * const tagllnk
+	TagReference * const tagref
 ) {
-	gnui_tagged_entry_tag_reference_destroy(self, ((GList *) tagllnk)->data);
-	priv->taglist = g_list_delete_link(priv->taglist, tagllnk);
+	gnui_tagged_entry_unindex_tagref(self, priv, tagref);
+	gnui_tagged_entry_snapshot_remove(priv, tagref);
+	g_sequence_remove(tagref->iter);
 	priv->tag_count--;
+	gnui_tagged_entry_tag_reference_destroy(self, tagref);
 	g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_TAGS]);
 	gnui_tagged_entry_dispatch_modified(self, priv, true);
 }
@@ -230,30 +877,59 @@ static inline void gnui_tagged_entry_delete_llnk (
 
 /**
 
-    gnui_tagged_entry_retrieve_tags:  
-    @list:      (not nullable): The tagged entry's tag list
-    @llen:      The length of the list
+    gnui_tagged_entry_lookup_tag:
+    @self:      (not nullable): The tagged entry
+    @priv:      (not nullable): The tagged entry's private `struct`
+    @tag:       (not nullable): The tag to look for
+
+    Find the `TagReference` of a tag, using the tagged entry's match function
+    if this is set
 
-    Retrieve all the tags of a list of `TagReference` objects and return is a
-    newly allocated array of strings
+    If the tagged entry has a tag index only the bucket that @tag hashes to is
+    scanned, otherwise all the tags are.
 
-    Returns:    A newly allocated array of strings containing the tags
+    Returns:    (nullable): The `TagReference` found, or `NULL`
 
 **/
-static inline gchar ** gnui_tagged_entry_retrieve_tags (
-	const GList * const list,
-	const gsize llen
+static inline TagReference * gnui_tagged_entry_lookup_tag (
+	GnuiTaggedEntry * const self,
+	GnuiTaggedEntryPrivate * const priv,
+	const gchar * const tag
 ) {
-	if (!list) return NULL;
-	gsize idx = llen;
-	const GList * llnk = list;
-	gchar ** const tags = g_new(gchar *, idx + 1);
-	tags[idx] = NULL;
-	while (idx > 0 && llnk) {
-		tags[--idx] = g_strdup(((TagReference *) llnk->data)->tag);
-		llnk = llnk->next;
+	TagReference * tagref;
+	if (priv->tag_index) {
+		for (
+			const GSList * llnk = g_hash_table_lookup(
+				priv->tag_index,
+				GUINT_TO_POINTER(gnui_tagged_entry_hash_tag(self, tag))
+			);
+				llnk;
+			llnk = llnk->next
+		) {
+			tagref = llnk->data;
+			if (
+				self->match_function ?
+					self->match_function(tagref->tag, tag, self->match_data)
+				:
+					!strcmp(tagref->tag, tag)
+			) return tagref;
+		}
+		return NULL;
+	}
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) {
+		tagref = g_sequence_get(iter);
+		if (
+			self->match_function ?
+				self->match_function(tagref->tag, tag, self->match_data)
+			:
+				!strcmp(tagref->tag, tag)
+		) return tagref;
 	}
-	return tags;
+	return NULL;
 }
 
 
@@ -297,7 +973,8 @@ static inline gchar * gnui_tagged_entry_sanitize_and_allocate_tag (
 
     gnui_tagged_entry__on_remover_click:
     @button:    (unused) (nullable): The remover `GtkButton`
-    @v_llnk:    (not nullable): The list link to remove (passed as `gpointer`)
+    @v_tagref:  (not nullable): The `TagReference` to remove (passed as
+                `gpointer`)
 
     Event handler for the #GtkButton::clicked event of each tag's remover
     `GtkButton`
@@ -305,179 +982,400 @@ static inline gchar * gnui_tagged_entry_sanitize_and_allocate_tag (
 **/
 static void gnui_tagged_entry__on_remover_click (
 	GtkButton * const button G_GNUC_UNUSED,
-	const gpointer v_llnk
+	const gpointer v_tagref
 ) {
 
-	if (((TagReference *) ((GList *) v_llnk)->data)->pinned) {
+	#define tagref ((TagReference *) v_tagref)
+
+	if (tagref->pinned) {
 
 		return;
 
 	}
 
-	GnuiTaggedEntry * const self =
-		((TagReference *) ((GList *) v_llnk)->data)->parent;
+	gnui_tagged_entry_delete_tagref(
+		tagref->parent,
+		gnui_tagged_entry_get_instance_private(tagref->parent),
+		tagref
+	);
+
+	#undef tagref
 
-	gnui_tagged_entry_delete_llnk(
-		self,
-		gnui_tagged_entry_get_instance_private(self),
-		v_llnk
+}
+
+
+/**
+
+    gnui_tagged_entry_compare_tag_references:
+    @v_tagref_1:    (not nullable): The first `TagReference` (passed as
+                    `gconstpointer`)
+    @v_tagref_2:    (not nullable): The second `TagReference` (passed as
+                    `gconstpointer`)
+    @v_self:        (not nullable): The tagged entry (passed as `gpointer`)
+
+    Compare two `TagReference` objects using the tagged entry's sort function
+    (which must be set)
+
+    Returns:    The result of the tagged entry's sort function
+
+**/
+static gint gnui_tagged_entry_compare_tag_references (
+	gconstpointer const v_tagref_1,
+	gconstpointer const v_tagref_2,
+	const gpointer v_self
+) {
+
+	return GNUI_TAGGED_ENTRY(v_self)->sort_function(
+		((const TagReference *) v_tagref_1)->tag,
+		((const TagReference *) v_tagref_2)->tag,
+		GNUI_TAGGED_ENTRY(v_self)->sort_data
+	);
+
+}
+
+
+/**
+
+    gnui_tagged_entry_reposition_box:
+    @self:      (not nullable): The tagged entry
+    @tagref:    (not nullable): The tag reference whose widget must be moved
+
+    Move the widget of a `TagReference` right after the widget of the tag that
+    precedes it in the tag sequence (or at the beginning, if there is none)
+
+**/
+static void gnui_tagged_entry_reposition_box (
+	GnuiTaggedEntry * const self,
+	TagReference * const tagref
+) {
+
+	gtk_widget_insert_after(
+		tagref->box,
+		GTK_WIDGET(self),
+		g_sequence_iter_is_begin(tagref->iter) ?
+			NULL
+		:
+			((TagReference *) g_sequence_get(
+				g_sequence_iter_prev(tagref->iter)
+			))->box
+	);
+
+}
+
+
+/**
+
+    gnui_tagged_entry_place_tagref:
+    @self:      (not nullable): The tagged entry
+    @priv:      (not nullable): The tagged entry's private `struct`
+    @tagref:    (not nullable): The tag reference to place
+
+    Insert a `TagReference` in the tag sequence (or move it there from another
+    sequence, if its `iter` member is not `NULL`) and place its widget after
+    the widget of the tag that precedes it
+
+    Both the position in the sequence and the sibling widget are found in
+    logarithmic time.
+
+**/
+static void gnui_tagged_entry_place_tagref (
+	GnuiTaggedEntry * const self,
+	GnuiTaggedEntryPrivate * const priv,
+	TagReference * const tagref
+) {
+
+	GSequenceIter * const dest =
+		self->sort_function ?
+			g_sequence_search(
+				priv->tag_sequence,
+				tagref,
+				gnui_tagged_entry_compare_tag_references,
+				self
+			)
+		:
+			g_sequence_get_end_iter(priv->tag_sequence);
+
+	if (tagref->iter) {
+
+		g_sequence_move(tagref->iter, dest);
+
+	} else {
+
+		tagref->iter = g_sequence_insert_before(dest, tagref);
+
+	}
+
+	gnui_tagged_entry_reposition_box(self, tagref);
+
+}
+
+
+/**
+
+    gnui_tagged_entry_tag_reference_build:
+    @self:      (not nullable): The tagged entry
+    @tagref:    (not nullable): The `TagReference` whose widgets must be built
+
+    Create the widgets of a `TagReference`, without placing them anywhere
+
+    If #GnuiTaggedEntry:lightweight-tags is set a single `GnuiTagChip` is
+    created, otherwise a `GtkBox` containing a `GtkLabel` and a remover
+    `GtkButton` is.
+
+**/
+static void gnui_tagged_entry_tag_reference_build (
+	GnuiTaggedEntry * const self,
+	TagReference * const tagref
+) {
+
+	if (self->lightweight_tags) {
+
+		tagref->box = gnui_tag_chip_new(tagref);
+		tagref->marker = NULL;
+		tagref->remover = NULL;
+		return;
+
+	}
+
+	GtkWidget
+		* const tagbox = g_object_new(
+			GTK_TYPE_BOX,
+			"orientation", GTK_ORIENTATION_HORIZONTAL,
+			"spacing", 6,
+			"hexpand", false,
+			"vexpand", false,
+			"halign", GTK_ALIGN_CENTER,
+			NULL
+		),
+		* _widget_placeholder_;
+
+	tagref->box = tagbox;
+
+	#define label _widget_placeholder_
+
+	label = g_object_new(
+		GTK_TYPE_LABEL,
+		"label", tagref->tag,
+		"hexpand", true,
+		NULL
+	);
+
+	gtk_widget_add_css_class(tagbox, "tag");
+	gtk_widget_add_css_class(label, "content");
+	gtk_box_append(GTK_BOX(tagbox), label);
+	tagref->marker = GTK_LABEL(label);
+
+	#undef label
+	#define button _widget_placeholder_
+
+	button = g_object_new(
+		GTK_TYPE_BUTTON,
+		"label", "\303\227",
+		"sensitive", !tagref->pinned,
+		NULL
+	);
+
+	gtk_widget_set_cursor_from_name(button, "pointer");
+	gtk_widget_add_css_class(button, "remover");
+	gtk_box_append(GTK_BOX(tagbox), button);
+	tagref->remover = button;
+
+	g_signal_connect(
+		button,
+		"clicked",
+		G_CALLBACK(gnui_tagged_entry__on_remover_click),
+		tagref
 	);
 
+	#undef button
+
+}
+
+
+/**
+
+    gnui_tagged_entry_tag_reference_new:
+    @self:          (not nullable): The tagged entry
+    @priv:          (not nullable): The tagged entry's private `struct`
+    @sanitized_tag: (transfer full) (not nullable): The sanitized tag
+    @pinned:        Whether the tag must appear as "pinned"
+
+    Create a new `TagReference` together with its widgets, without placing it
+    anywhere
+
+    Returns:    (transfer full): The newly created `TagReference`
+
+**/
+static TagReference * gnui_tagged_entry_tag_reference_new (
+	GnuiTaggedEntry * const self,
+	GnuiTaggedEntryPrivate * const priv,
+	gchar * const sanitized_tag,
+	const gboolean pinned
+) {
+
+	TagReference * const tagref = g_new(TagReference, 1);
+
+	tagref->parent = self;
+	tagref->tag = sanitized_tag;
+	tagref->iter = NULL;
+	tagref->id = priv->next_id++;
+	tagref->pinned = pinned;
+	gnui_tagged_entry_tag_reference_build(self, tagref);
+	return tagref;
+
 }
 
 
 /**
 
-    gnui_tagged_entry_insert_tagref_sorted:
+    gnui_tagged_entry_rebuild_tag_widgets:
     @self:      (not nullable): The tagged entry
     @priv:      (not nullable): The tagged entry's private `struct`
-    @tagref:    (not nullable): The tag reference to insert
 
-    Insert a `TagReference` without a parent
-
-    Returns:    The new list link inserted
+    Replace the widgets of all the tags (used when the
+    #GnuiTaggedEntry:lightweight-tags property changes)
 
 **/
-static GList * gnui_tagged_entry_insert_tagref_sorted (
+static void gnui_tagged_entry_rebuild_tag_widgets (
 	GnuiTaggedEntry * const self,
-	GnuiTaggedEntryPrivate * const priv,
-	TagReference * const tagref
+	GnuiTaggedEntryPrivate * const priv
 ) {
 
-	GList * llink = priv->taglist;
-
-	if (llink && self->sort_function) {
-
-
-		/* \                                  /\
-		\ */     insert_tagref_sorted:       /* \
-		 \/     ________________________     \ */
-
-
-		if (
-			self->sort_function(
-				((TagReference *) llink->data)->tag,
-				tagref->tag,
-				self->sort_data
-			) > 0
-		) {
-
-			if (llink->next) {
+	TagReference * tagref;
 
-				llink = llink->next;
-				goto insert_tagref_sorted;
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) {
 
-			}
+		tagref = g_sequence_get(iter);
+		gtk_widget_unparent(tagref->box);
+		gnui_tagged_entry_tag_reference_build(self, tagref);
+		gtk_widget_insert_before(tagref->box, GTK_WIDGET(self), priv->textbox);
 
-			llink = g_list_append(
-				llink,
-				tagref
-			);
+	}
 
-			gtk_widget_insert_after(tagref->box, GTK_WIDGET(self), NULL);
-			llink = llink->next;
+}
 
-		} else {
 
-			priv->taglist = g_list_insert_before(priv->taglist, llink, tagref);
+/**
 
-			gtk_widget_insert_after(
-				tagref->box,
-				GTK_WIDGET(self),
-				((TagReference *) llink->data)->box
-			);
+    gnui_tagged_entry_pick_remover:
+    @self:      (not nullable): The tagged entry
+    @x:         The X coordinate of the point
+    @y:         The Y coordinate of the point
 
-			llink = llink->prev;
+    Find the lightweight tag chip whose remover lies under a point
 
-		}
+    Returns:    (transfer none) (nullable): The tag chip, or `NULL` if there is
+                no remover under the point (or if its tag is pinned)
 
-	} else {
+**/
+static GtkWidget * gnui_tagged_entry_pick_remover (
+	GnuiTaggedEntry * const self,
+	const gdouble x,
+	const gdouble y
+) {
 
-		priv->taglist = llink = g_list_prepend(llink, tagref);
-		gtk_widget_insert_before(tagref->box, GTK_WIDGET(self), priv->textbox);
+	GtkWidget * const picked =
+		gtk_widget_pick(GTK_WIDGET(self), x, y, GTK_PICK_DEFAULT);
 
-	}
+	const graphene_point_t click = GRAPHENE_POINT_INIT(x, y);
+	graphene_point_t point;
 
-	return llink;
+	return
+		!GNUI_IS_TAG_CHIP(picked) ||
+		GNUI_TAG_CHIP(picked)->tagref->pinned ||
+		!gtk_widget_compute_point(GTK_WIDGET(self), picked, &click, &point) ||
+		point.x < GNUI_TAG_CHIP(picked)->remover_x ?
+			NULL
+		:
+			picked;
 
 }
 
 
 /**
 
-    gnui_tagged_entry_insert_llink_sorted:
-    @self:      (not nullable): The tagged entry
-    @priv:      (not nullable): The tagged entry's private `struct`
-    @tagllnk:   (not nullable): The list link to insert
+    gnui_tagged_entry__on_click_press:
+    @gesture:   (unused) (not nullable): The tagged entry's `GtkGestureClick`
+    @n_press:   (unused): The number of presses
+    @x:         The X coordinate of the click
+    @y:         The Y coordinate of the click
+    @v_self:    (not nullable): The tagged entry (passed as `gpointer`)
 
-    Insert a doubly-linked link containing a `TagReference` without a parent
+    Event handler for the #GtkGestureClick::pressed event of the tagged entry,
+    which remembers the tag whose lightweight remover has been pressed (if
+    any)
 
 **/
-static void gnui_tagged_entry_insert_llink_sorted (
-	GnuiTaggedEntry * const self,
-	GnuiTaggedEntryPrivate * const priv,
-	GList * tagllnk
+static void gnui_tagged_entry__on_click_press (
+	GtkGestureClick * const gesture G_GNUC_UNUSED,
+	const gint n_press G_GNUC_UNUSED,
+	const gdouble x,
+	const gdouble y,
+	const gpointer v_self
 ) {
 
-	GList * sibling = priv->taglist;
+	GnuiTaggedEntryPrivate * const priv =
+		gnui_tagged_entry_get_instance_private(v_self);
 
-	if (sibling && self->sort_function) {
+	GtkWidget * const chip = gnui_tagged_entry_pick_remover(v_self, x, y);
 
+	if ((priv->remover_pressed = chip != NULL)) {
 
-		/* \                                  /\
-		\ */     insert_llnk_sorted:         /* \
-		 \/     ________________________     \ */
+		priv->pressed_id = GNUI_TAG_CHIP(chip)->tagref->id;
 
+	}
 
-		if (
-			self->sort_function(
-				((TagReference *) sibling->data)->tag,
-				((TagReference *) tagllnk->data)->tag,
-				self->sort_data
-			) > 0
-		) {
+}
 
-			if (sibling->next) {
 
-				sibling = sibling->next;
-				goto insert_llnk_sorted;
+/**
 
-			}
+    gnui_tagged_entry__on_click_release:
+    @gesture:   (unused) (not nullable): The tagged entry's `GtkGestureClick`
+    @n_press:   (unused): The number of presses
+    @x:         The X coordinate of the click
+    @y:         The Y coordinate of the click
+    @v_self:    (not nullable): The tagged entry (passed as `gpointer`)
 
-			sibling->next = tagllnk;
-			tagllnk->prev = sibling;
-			tagllnk->next = NULL;
+    Event handler for the #GtkGestureClick::released event of the tagged
+    entry, which removes the tag of a lightweight chip if the click both
+    started and ended on its remover
 
-			gtk_widget_insert_after(
-				((TagReference *) tagllnk->data)->box,
-				GTK_WIDGET(self),
-				NULL
-			);
+**/
+static void gnui_tagged_entry__on_click_release (
+	GtkGestureClick * const gesture G_GNUC_UNUSED,
+	const gint n_press G_GNUC_UNUSED,
+	const gdouble x,
+	const gdouble y,
+	const gpointer v_self
+) {
 
-		} else {
+	GnuiTaggedEntryPrivate * const priv =
+		gnui_tagged_entry_get_instance_private(v_self);
 
-			priv->taglist = g_list_insert_before_link(
-				priv->taglist,
-				sibling,
-				tagllnk
-			);
+	if (!priv->remover_pressed) {
 
-			gtk_widget_insert_after(
-				((TagReference *) tagllnk->data)->box,
-				GTK_WIDGET(self),
-				((TagReference *) sibling->data)->box
-			);
+		return;
 
-		}
+	}
 
-	} else {
+	GtkWidget * const chip = gnui_tagged_entry_pick_remover(v_self, x, y);
 
-		priv->taglist = gnui_list_prepend_llink(sibling, tagllnk);
+	priv->remover_pressed = false;
 
-		gtk_widget_insert_before(
-			((TagReference *) tagllnk->data)->box,
-			GTK_WIDGET(self),
-			priv->textbox
+	/*  Tag IDs are never reused, so a chip destroyed in the meantime cannot
+		be mistaken for another one  */
+
+	if (chip && GNUI_TAG_CHIP(chip)->tagref->id == priv->pressed_id) {
+
+		gnui_tagged_entry_delete_tagref(
+			v_self,
+			priv,
+			GNUI_TAG_CHIP(chip)->tagref
 		);
 
 	}
@@ -513,64 +1411,16 @@ static void gnui_tagged_entry_add_sanitized_tag (
 	const gboolean pinned
 ) {
 
-	GtkWidget
-		* const tagbox = g_object_new(
-			GTK_TYPE_BOX,
-			"orientation", GTK_ORIENTATION_HORIZONTAL,
-			"spacing", 6,
-			"hexpand", false,
-			"vexpand", false,
-			"halign", GTK_ALIGN_CENTER,
-			NULL
-		),
-		* _widget_placeholder_;
-
-	TagReference * tagref = g_new(TagReference, 1);
-
-	tagref->parent = self;
-	tagref->box = tagbox;
-	tagref->tag = sanitized_tag;
-	tagref->id = priv->next_id++;
-	tagref->pinned = pinned;
-
-	#define label _widget_placeholder_
-
-	label = g_object_new(
-		GTK_TYPE_LABEL,
-		"label", sanitized_tag,
-		"hexpand", true,
-		NULL
-	);
-
-	gtk_widget_add_css_class(tagbox, "tag");
-	gtk_widget_add_css_class(label, "content");
-	gtk_box_append(GTK_BOX(tagbox), label);
-	tagref->marker = GTK_LABEL(label);
-
-	#undef label
-	#define button _widget_placeholder_
-
-	button = g_object_new(
-		GTK_TYPE_BUTTON,
-		"label", "\303\227",
-		"sensitive", !pinned,
-		NULL
-	);
-
-	gtk_widget_set_cursor_from_name(button, "pointer");
-	gtk_widget_add_css_class(button, "remover");
-	gtk_box_append(GTK_BOX(tagbox), button);
-	tagref->remover = button;
-
-	g_signal_connect(
-		button,
-		"clicked",
-		G_CALLBACK(gnui_tagged_entry__on_remover_click),
-		gnui_tagged_entry_insert_tagref_sorted(self, priv, tagref)
+	TagReference * const tagref = gnui_tagged_entry_tag_reference_new(
+		self,
+		priv,
+		sanitized_tag,
+		pinned
 	);
 
-	#undef button
-
+	gnui_tagged_entry_place_tagref(self, priv, tagref);
+	gnui_tagged_entry_index_tagref(self, priv, tagref);
+	gnui_tagged_entry_snapshot_insert(priv, tagref);
 	priv->tag_count++;
 	g_signal_emit(self, signals[SIGNAL_TAG_ADDED], 0, sanitized_tag);
 	gnui_tagged_entry_dispatch_modified(self, priv, true);
@@ -616,6 +1466,225 @@ static inline bool gnui_tagged_entry_sanitize_and_add_tag (
 }
 
 
+/**
+
+    gnui_tagged_entry_compare_tag_reference_ptrs:
+    @v_tagref_ptr_1:    (not nullable): A pointer to the first
+                        `TagReference` (passed as `gconstpointer`)
+    @v_tagref_ptr_2:    (not nullable): A pointer to the second
+                        `TagReference` (passed as `gconstpointer`)
+    @v_self:            (not nullable): The tagged entry (passed as
+                        `gpointer`)
+
+    Compare two `TagReference` objects stored in a `GPtrArray` using the
+    tagged entry's sort function (which must be set)
+
+    Returns:    The result of the tagged entry's sort function
+
+**/
+static gint gnui_tagged_entry_compare_tag_reference_ptrs (
+	gconstpointer const v_tagref_ptr_1,
+	gconstpointer const v_tagref_ptr_2,
+	const gpointer v_self
+) {
+
+	return gnui_tagged_entry_compare_tag_references(
+		*((TagReference * const *) v_tagref_ptr_1),
+		*((TagReference * const *) v_tagref_ptr_2),
+		v_self
+	);
+
+}
+
+
+/**
+
+    gnui_tagged_entry_repopulate:
+    @self:      (not nullable): The tagged entry
+    @priv:      (not nullable): The tagged entry's private `struct`
+    @tags:      (nullable): A `NULL`-terminated array of unsanitized tags
+    @pinned:    Whether the new tags must appear as "pinned"
+
+    Replace all the tags of a tagged entry in one pass
+
+    All the input strings are sanitized and filtered first; duplicates (after
+    sanitization, according to the match function if this is set) are
+    dropped, tags that are already present keep their widgets, and only then
+    the tags are sorted once and laid out in order.
+
+    The #GnuiTaggedEntry:tags and #GnuiTaggedEntry:modified properties are
+    notified once; the #GnuiTaggedEntry::tag-removed and
+    #GnuiTaggedEntry::tag-added signals are emitted for each tag removed or
+    added, followed by a single #GnuiTaggedEntry::tags-added signal.
+
+    Returns:    `true` if all the tags were successfully added, `false`
+                otherwise
+
+**/
+static bool gnui_tagged_entry_repopulate (
+	GnuiTaggedEntry * const self,
+	GnuiTaggedEntryPrivate * const priv,
+	const gchar * const * const tags,
+	const gboolean pinned
+) {
+
+	GSequence * const old_tags = priv->tag_sequence;
+	GPtrArray * const batch = g_ptr_array_new();
+	GPtrArray * const added = g_ptr_array_new();
+	TagReference * tagref;
+	gchar * sanitized_tag;
+	bool all_added = true;
+
+	/*  The new tags are gathered in a private `struct` of their own, so that
+		duplicates are looked up with the same match function (and the same
+		index) that `gnui_tagged_entry_add_tag()` uses  */
+
+	GnuiTaggedEntryPrivate fresh = { .tag_sequence = g_sequence_new(NULL) };
+
+	gnui_tagged_entry_rebuild_index(self, &fresh);
+
+	for (const gchar * const * tagptr = tags; tagptr && *tagptr; tagptr++) {
+
+		if (!(sanitized_tag = gnui_tagged_entry_sanitize_and_allocate_tag(
+			self,
+			*tagptr
+		))) {
+
+			all_added = false;
+			continue;
+
+		}
+
+		if (gnui_tagged_entry_lookup_tag(self, &fresh, sanitized_tag)) {
+
+			g_free(sanitized_tag);
+			continue;
+
+		}
+
+		if (
+			(tagref = gnui_tagged_entry_lookup_tag(self, priv, sanitized_tag))
+		) {
+
+			/*  This tag is already present -- keep the widgets  */
+
+			gnui_tagged_entry_unindex_tagref(self, priv, tagref);
+
+			g_sequence_move(
+				tagref->iter,
+				g_sequence_get_end_iter(fresh.tag_sequence)
+			);
+
+			g_free(sanitized_tag);
+
+		} else {
+
+			/*  The tag is new -- create it  */
+
+			tagref = gnui_tagged_entry_tag_reference_new(
+				self,
+				priv,
+				sanitized_tag,
+				pinned
+			);
+
+			tagref->iter = g_sequence_append(fresh.tag_sequence, tagref);
+			g_ptr_array_add(added, tagref->tag);
+
+		}
+
+		gnui_tagged_entry_index_tagref(self, &fresh, tagref);
+		g_ptr_array_add(batch, tagref);
+
+	}
+
+	if (self->sort_function) {
+
+		g_ptr_array_sort_with_data(
+			batch,
+			gnui_tagged_entry_compare_tag_reference_ptrs,
+			self
+		);
+
+	}
+
+	/*  Put the new sequence in order and lay out the widgets accordingly  */
+
+	for (guint idx = 0; idx < batch->len; idx++) {
+
+		tagref = batch->pdata[idx];
+
+		if (self->sort_function) {
+
+			g_sequence_move(
+				tagref->iter,
+				g_sequence_get_end_iter(fresh.tag_sequence)
+			);
+
+		}
+
+		gtk_widget_insert_before(tagref->box, GTK_WIDGET(self), priv->textbox);
+
+	}
+
+	priv->tag_sequence = fresh.tag_sequence;
+	g_clear_pointer(&priv->tag_index, g_hash_table_unref);
+	priv->tag_index = fresh.tag_index;
+	gnui_tagged_entry_snapshot_rebuild(priv);
+
+	/*  The state must be consistent before any tag-removed handler runs  */
+
+	priv->tag_count = batch->len;
+	g_ptr_array_unref(batch);
+
+	/*  Destroy the remaining old tags  */
+
+	const bool changed = added->len || !g_sequence_is_empty(old_tags);
+
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(old_tags);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) {
+
+		gnui_tagged_entry_tag_reference_destroy(self, g_sequence_get(iter));
+
+	}
+
+	g_sequence_free(old_tags);
+
+	if (added->len) {
+
+		for (guint idx = 0; idx < added->len; idx++) {
+
+			g_signal_emit(
+				self,
+				signals[SIGNAL_TAG_ADDED],
+				0,
+				(const gchar *) added->pdata[idx]
+			);
+
+		}
+
+		g_ptr_array_add(added, NULL);
+		g_signal_emit(self, signals[SIGNAL_TAGS_ADDED], 0, added->pdata);
+
+	}
+
+	g_ptr_array_free(added, true);
+
+	if (changed) {
+
+		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_TAGS]);
+		gnui_tagged_entry_dispatch_modified(self, priv, true);
+
+	}
+
+	return all_added;
+
+}
+
+
 /**
 
     gnui_tagged_entry_tokenize_parse_expression_but_last:
@@ -1066,29 +2135,29 @@ static void gnui_tagged_entry__on_textbox_backspace (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(GNUI_TAGGED_ENTRY(v_self));
 
-	if (!priv->taglist) {
+	GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
+
+	if (g_sequence_iter_is_end(iter)) {
 
 		return;
 
 	}
 
-	GList * llnk = priv->taglist, * delllnk = llnk;
-	gsize last_id = ((TagReference *) llnk->data)->id;
+	TagReference * tagref, * deltagref = g_sequence_get(iter);
 
 	g_signal_stop_emission_by_name(textbox, "backspace");
 
-	while ((llnk = llnk->next)) {
+	while (!g_sequence_iter_is_end((iter = g_sequence_iter_next(iter)))) {
 
-		if (((TagReference *) llnk->data)->id > last_id) {
+		if ((tagref = g_sequence_get(iter))->id > deltagref->id) {
 
-			delllnk = llnk;
-			last_id = ((TagReference *) llnk->data)->id;
+			deltagref = tagref;
 
 		}
 
 	}
 
-	gnui_tagged_entry_delete_llnk(v_self, priv, delllnk);
+	gnui_tagged_entry_delete_tagref(v_self, priv, deltagref);
 
 }
 
@@ -1125,11 +2194,18 @@ static void gnui_tagged_entry_dispose (
 
 	}
 
-	for (const GList * llnk = priv->taglist; llnk; llnk = llnk->next) {
+	TagReference * tagref;
+
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) {
 
-		gtk_widget_unparent(((TagReference *) llnk->data)->box);
-		g_free(((TagReference *) llnk->data)->tag);
-		g_free(llnk->data);
+		tagref = g_sequence_get(iter);
+		gtk_widget_unparent(tagref->box);
+		g_free(tagref->tag);
+		g_free(tagref);
 
 	}
 
@@ -1139,9 +2215,10 @@ static void gnui_tagged_entry_dispose (
 
 	}
 
-	g_list_free(priv->taglist);
+	g_clear_pointer(&priv->tag_index, g_hash_table_unref);
+	g_clear_pointer(&priv->tag_sequence, g_sequence_free);
 	g_free(GNUI_TAGGED_ENTRY(self)->delimiter_chars);
-	g_strfreev(GNUI_TAGGED_ENTRY(self)->tags);
+	g_clear_pointer(&priv->tag_snapshot, g_ptr_array_unref);
 	G_OBJECT_CLASS(gnui_tagged_entry_parent_class)->dispose(object);
 
 }
@@ -1193,11 +2270,21 @@ static void gnui_tagged_entry_get_property (
 			g_value_set_pointer(value, *((gpointer *) &self->filter_function));
 			break;
 
+		case PROPERTY_HASH_FUNCTION:
+
+			g_value_set_pointer(value, *((gpointer *) &self->hash_function));
+			break;
+
 		case PROPERTY_INVALID:
 
 			g_value_set_boolean(value, self->invalid);
 			break;
 
+		case PROPERTY_LIGHTWEIGHT_TAGS:
+
+			g_value_set_boolean(value, self->lightweight_tags);
+			break;
+
 		case PROPERTY_MATCH_DATA:
 
 			g_value_set_pointer(value, self->match_data);
@@ -1250,20 +2337,10 @@ static void gnui_tagged_entry_get_property (
 
 			/*  Transfer none  */
 
-			if (priv->tags_have_changed || !self->tags) {
-
-				g_strfreev(self->tags);
-
-				self->tags = gnui_tagged_entry_retrieve_tags(
-					priv->taglist,
-					priv->tag_count
-				);
-
-				priv->tags_have_changed = false;
-
-			}
-
-			g_value_set_static_boxed(value, self->tags);
+			g_value_set_static_boxed(
+				value,
+				priv->tag_count ? priv->tag_snapshot->pdata : NULL
+			);
 
 			break;
 
@@ -1351,6 +2428,25 @@ static void gnui_tagged_entry_set_property (
 			gnui_tagged_entry_invalidate_filter(self);
 			break;
 
+		case PROPERTY_HASH_FUNCTION:
+
+			*((gpointer *) &val.f) = g_value_get_pointer(value);
+
+			if (self->hash_function == (GnuiTaggedEntryHashFunc) val.f) {
+
+				return;
+
+			}
+
+			self->hash_function = (GnuiTaggedEntryHashFunc) val.f;
+
+			gnui_tagged_entry_rebuild_index(
+				self,
+				gnui_tagged_entry_get_instance_private(self)
+			);
+
+			break;
+
 		case PROPERTY_INVALID:
 
 			if ((val.b = g_value_get_boolean(value)) == self->invalid) {
@@ -1372,6 +2468,25 @@ static void gnui_tagged_entry_set_property (
 			/*  Keep `return` here!  */
 			return;
 
+		case PROPERTY_LIGHTWEIGHT_TAGS:
+
+			if (
+				(val.b = g_value_get_boolean(value)) == self->lightweight_tags
+			) {
+
+				return;
+
+			}
+
+			self->lightweight_tags = val.b;
+
+			gnui_tagged_entry_rebuild_tag_widgets(
+				self,
+				gnui_tagged_entry_get_instance_private(self)
+			);
+
+			break;
+
 		case PROPERTY_MATCH_DATA:
 
 			if ((val.p = g_value_get_pointer(value)) == self->match_data) {
@@ -1381,6 +2496,16 @@ static void gnui_tagged_entry_set_property (
 			}
 
 			self->match_data = val.p;
+
+			if (self->hash_function) {
+
+				gnui_tagged_entry_rebuild_index(
+					self,
+					gnui_tagged_entry_get_instance_private(self)
+				);
+
+			}
+
 			break;
 
 		case PROPERTY_MATCH_FUNCTION:
@@ -1394,6 +2519,12 @@ static void gnui_tagged_entry_set_property (
 			}
 
 			self->match_function = (GnuiTaggedEntryMatchFunc) val.f;
+
+			gnui_tagged_entry_rebuild_index(
+				self,
+				gnui_tagged_entry_get_instance_private(self)
+			);
+
 			break;
 
 		case PROPERTY_MODIFIED:
@@ -1595,6 +2726,19 @@ static void gnui_tagged_entry_class_init (
 		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
 	);
 
+	/**
+
+	    GnuiTaggedEntry:hash-function: (nullable)
+
+	**/
+	props[PROPERTY_HASH_FUNCTION] = g_param_spec_pointer(
+		"hash-function",
+		"GnuiTaggedEntryHashFunc",
+		"Function to use to hash tags consistently with "
+			"\342\200\234match-function\342\200\235",
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
 	props[PROPERTY_INVALID] = g_param_spec_boolean(
 		"invalid",
 		"gboolean",
@@ -1603,6 +2747,15 @@ static void gnui_tagged_entry_class_init (
 		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
 	);
 
+	props[PROPERTY_LIGHTWEIGHT_TAGS] = g_param_spec_boolean(
+		"lightweight-tags",
+		"gboolean",
+		"Whether each tag is drawn by a single lightweight widget instead of "
+			"a box containing a label and a button",
+		false,
+		G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS
+	);
+
 	/**
 
 	    GnuiTaggedEntry:match-data: (nullable) (closure)
@@ -1870,6 +3023,39 @@ static void gnui_tagged_entry_class_init (
 		G_TYPE_STRING | G_SIGNAL_TYPE_STATIC_SCOPE
 	);
 
+	/**
+
+	    GnuiTaggedEntry::tags-added:
+	    @self:      (auto) (non-nullable): The tagged entry that emitted the
+	                signal
+	    @tags:      (auto) (not nullable) (transfer none) (array
+	                zero-terminated=1): The tags added
+
+	    Signal emitted once after the tagged entry has been populated in bulk
+	    (see `gnui_tagged_entry_populate()`,
+	    `gnui_tagged_entry_populate_strv()` and
+	    `gnui_tagged_entry_set_tags()`), carrying all the tags that were not
+	    present before
+
+	    #GnuiTaggedEntrySignalHandlerTagsAdded is the function type of
+	    reference for this signal, which takes parameters' constness into
+	    account.
+
+	**/
+	signals[SIGNAL_TAGS_ADDED] = g_signal_new(
+		I_("tags-added"),
+		G_TYPE_FROM_CLASS(klass),
+		G_SIGNAL_RUN_FIRST,
+		0,
+		NULL,
+		NULL,
+		g_cclosure_marshal_VOID__BOXED,
+		G_TYPE_NONE,
+		1,
+		/*  Maps `const gchar * const * tags`  */
+		G_TYPE_STRV | G_SIGNAL_TYPE_STATIC_SCOPE
+	);
+
 }
 
 
@@ -1891,6 +3077,11 @@ static void gnui_tagged_entry_init (
 	/*  `-DGNUI_TAGGED_ENTRY_BUILD_FLAG_MANUAL_ENVIRONMENT` erases this  */
 	GNUI_MODULE_ENSURE_ENVIRONMENT
 
+	priv->tag_sequence = g_sequence_new(NULL);
+	priv->tag_snapshot = g_ptr_array_new();
+	g_ptr_array_add(priv->tag_snapshot, NULL);
+	gnui_tagged_entry_rebuild_index(self, priv);
+
 	g_object_set(
 		G_OBJECT(gtk_widget_get_layout_manager(GTK_WIDGET(self))),
 		"orientation", GTK_ORIENTATION_HORIZONTAL,
@@ -1934,6 +3125,29 @@ static void gnui_tagged_entry_init (
 	gtk_widget_insert_before(priv->textbox, GTK_WIDGET(self), NULL);
 	gtk_widget_add_css_class(GTK_WIDGET(self), "tagged");
 
+	GtkGesture * const gesture = gtk_gesture_click_new();
+
+	gtk_gesture_single_set_button(
+		GTK_GESTURE_SINGLE(gesture),
+		GDK_BUTTON_PRIMARY
+	);
+
+	g_signal_connect(
+		gesture,
+		"pressed",
+		G_CALLBACK(gnui_tagged_entry__on_click_press),
+		self
+	);
+
+	g_signal_connect(
+		gesture,
+		"released",
+		G_CALLBACK(gnui_tagged_entry__on_click_release),
+		self
+	);
+
+	gtk_widget_add_controller(GTK_WIDGET(self), GTK_EVENT_CONTROLLER(gesture));
+
 }
 
 
@@ -2007,39 +3221,7 @@ gboolean gnui_tagged_entry_has_tag (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
-	if (self->match_function) {
-
-		for (const GList * llnk = priv->taglist; llnk; llnk = llnk->next) {
-
-			if (
-				self->match_function(
-					((TagReference *) llnk->data)->tag,
-					tag,
-					self->match_data
-				)
-			) {
-
-				return true;
-
-			}
-
-		}
-
-		return false;
-
-	}
-
-	for (const GList * llnk = priv->taglist; llnk; llnk = llnk->next) {
-
-		if (!strcmp(((TagReference *) llnk->data)->tag, tag)) {
-
-			return true;
-
-		}
-
-	}
-
-	return false;
+	return gnui_tagged_entry_lookup_tag(self, priv, tag) != NULL;
 
 }
 
@@ -2061,41 +3243,17 @@ gboolean gnui_tagged_entry_remove_tag (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
-	if (self->match_function) {
-
-		for (GList * llnk = priv->taglist; llnk; llnk = llnk->next) {
-
-			if (
-				self->match_function(
-					((TagReference *) llnk->data)->tag,
-					tag,
-					self->match_data
-				)
-			) {
-
-				gnui_tagged_entry_delete_llnk(self, priv, llnk);
-				return true;
+	TagReference * const tagref =
+		gnui_tagged_entry_lookup_tag(self, priv, tag);
 
-			}
-
-		}
+	if (!tagref) {
 
 		return false;
 
 	}
 
-	for (GList * llnk = priv->taglist; llnk; llnk = llnk->next) {
-
-		if (!strcmp(((TagReference *) llnk->data)->tag, tag)) {
-
-			gnui_tagged_entry_delete_llnk(self, priv, llnk);
-			return true;
-
-		}
-
-	}
-
-	return false;
+	gnui_tagged_entry_delete_tagref(self, priv, tagref);
+	return true;
 
 }
 
@@ -2109,240 +3267,97 @@ void gnui_tagged_entry_remove_all_tags (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
-	if (!priv->taglist) {
+	if (!priv->tag_count) {
 
 		return;
 
 	}
 
-	for (const GList * llnk = priv->taglist; llnk; llnk = llnk->next) {
-
-		gnui_tagged_entry_tag_reference_destroy(self, llnk->data);
-
-	}
-
-	g_clear_pointer(&priv->taglist, g_list_free);
-	priv->tag_count = 0;
-	priv->next_id = 0;
-	g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_TAGS]);
-	gnui_tagged_entry_dispatch_modified(self, priv, true);
-
-}
-
-
-G_GNUC_NULL_TERMINATED gboolean gnui_tagged_entry_populate (
-	GnuiTaggedEntry * const self,
-	const gboolean pinned,
-	...
-) {
-
-	g_return_val_if_fail(GNUI_IS_TAGGED_ENTRY(self), false);
-
-	GnuiTaggedEntryPrivate * const priv =
-		gnui_tagged_entry_get_instance_private(self);
-
-	const gchar * tag;
-	gchar * sanitized_tag;
-	GList * llnk, * old_tags = g_steal_pointer(&priv->taglist);
-	TagReference * tagref;
-	bool changed = false, all_added = true;
-	va_list args;
-
-	va_start(args, pinned);
-	old_tags = g_list_reverse(old_tags);
-
-
-	/* \                                  /\
-	\ */     next_new_tag:               /* \
-	 \/     ________________________     \ */
-
-
-	if ((tag = va_arg(args, const gchar *))) {
-
-		llnk = old_tags;
-		sanitized_tag = gnui_tagged_entry_sanitize_and_allocate_tag(self, tag);
-
-		if (!sanitized_tag) {
-
-			all_added = false;
-			goto next_new_tag;
-
-		}
-
-
-		/* \                                  /\
-		\ */     next_old_tag:               /* \
-		 \/     ________________________     \ */
-
-
-		if (llnk) {
-
-			tagref = llnk->data;
-
-			if (strcmp(sanitized_tag, tagref->tag)) {
-
-				llnk = llnk->next;
-				goto next_old_tag;
-
-			}
-
-			/*  This tag is already present -- keep the widgets  */
-
-			g_free(tagref->tag);
-			tagref->tag = sanitized_tag;
-			old_tags = g_list_remove_link(old_tags, llnk);
-			g_object_ref(tagref->box);
-			gtk_widget_unparent(tagref->box);
-			gnui_tagged_entry_insert_llink_sorted(self, priv, llnk);
-			g_object_unref(tagref->box);
-			goto next_new_tag;
-
-		}
-
-		/*  The tag is new -- add it  */
-
-		gnui_tagged_entry_add_sanitized_tag(self, priv, sanitized_tag, pinned);
-		changed = true;
-		goto next_new_tag;
-
-	}
-
-	changed |= old_tags != NULL;
-
-	/*  Destroy the remaining old tags  */
-
-	for (const GList * llnk = old_tags; llnk; llnk = llnk->next) {
-
-		gnui_tagged_entry_tag_reference_destroy(self, llnk->data);
-		priv->tag_count--;
-
-	}
-
-	g_list_free(old_tags);
-
-	if (changed) {
-
-		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_TAGS]);
-		gnui_tagged_entry_dispatch_modified(self, priv, true);
-
-	}
-
-	va_end(args);
-	return all_added;
-
-}
-
-
-gboolean gnui_tagged_entry_populate_strv (
-	GnuiTaggedEntry * const self,
-	const gchar * const * const tags,
-	const gboolean pinned
-) {
-
-	g_return_val_if_fail(GNUI_IS_TAGGED_ENTRY(self), false);
-
-	GnuiTaggedEntryPrivate * const priv =
-		gnui_tagged_entry_get_instance_private(self);
+	GSequence * const old_tags = priv->tag_sequence;
 
-	TagReference * tagref;
-	gchar * sanitized_tag;
-	GList * llnk, * old_tags = g_steal_pointer(&priv->taglist);
-	bool changed = false, all_added = true;
+	g_ptr_array_set_size(priv->tag_snapshot, 0);
+	g_ptr_array_add(priv->tag_snapshot, NULL);
+	priv->tag_sequence = g_sequence_new(NULL);
 
-	if (!tags) {
+	if (priv->tag_index) {
 
-		goto clear_and_exit;
+		g_hash_table_remove_all(priv->tag_index);
 
 	}
 
-	const gchar * const * tagptr = tags - 1;
-	old_tags = g_list_reverse(old_tags);
-
-
-	/* \                                  /\
-	\ */     next_new_tag:               /* \
-	 \/     ________________________     \ */
-
-
-	if (*++tagptr) {
-
-		llnk = old_tags;
-
-		sanitized_tag = gnui_tagged_entry_sanitize_and_allocate_tag(
-			self,
-			*tagptr
-		);
-
-		if (!sanitized_tag) {
-
-			all_added = false;
-			goto next_new_tag;
-
-		}
-
-
-		/* \                                  /\
-		\ */     next_old_tag:               /* \
-		 \/     ________________________     \ */
-
-
-		if (llnk) {
-
-			tagref = llnk->data;
+	priv->tag_count = 0;
+	priv->next_id = 0;
+	priv->remover_pressed = false;
 
-			if (strcmp(sanitized_tag, tagref->tag)) {
+	/*  The state must be consistent before any tag-removed handler runs  */
 
-				llnk = llnk->next;
-				goto next_old_tag;
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(old_tags);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) {
 
-			}
+		gnui_tagged_entry_tag_reference_destroy(self, g_sequence_get(iter));
 
-			/*  This tag is already present -- keep the widgets  */
+	}
 
-			old_tags = g_list_remove_link(old_tags, llnk);
-			g_object_ref(tagref->box);
-			gtk_widget_unparent(tagref->box);
-			gnui_tagged_entry_insert_llink_sorted(self, priv, llnk);
-			g_object_unref(tagref->box);
-			goto next_new_tag;
+	g_sequence_free(old_tags);
+	g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_TAGS]);
+	gnui_tagged_entry_dispatch_modified(self, priv, true);
 
-		}
+}
 
-		/*  The tag is new -- add it  */
 
-		gnui_tagged_entry_add_sanitized_tag(self, priv, sanitized_tag, pinned);
-		changed = true;
-		goto next_new_tag;
+G_GNUC_NULL_TERMINATED gboolean gnui_tagged_entry_populate (
+	GnuiTaggedEntry * const self,
+	const gboolean pinned,
+	...
+) {
 
-	}
+	g_return_val_if_fail(GNUI_IS_TAGGED_ENTRY(self), false);
 
+	GPtrArray * const tags = g_ptr_array_new();
+	const gchar * tag;
+	va_list args;
 
-	/* \                                  /\
-	\ */     clear_and_exit:             /* \
-	 \/     ________________________     \ */
+	va_start(args, pinned);
 
+	while ((tag = va_arg(args, const gchar *))) {
 
-	changed |= old_tags != NULL;
+		g_ptr_array_add(tags, (gpointer) tag);
 
-	/*  Destroy the remaining old tags  */
+	}
 
-	for (const GList * llnk = old_tags; llnk; llnk = llnk->next) {
+	va_end(args);
+	g_ptr_array_add(tags, NULL);
 
-		gnui_tagged_entry_tag_reference_destroy(self, llnk->data);
-		priv->tag_count--;
+	const bool all_added = gnui_tagged_entry_repopulate(
+		self,
+		gnui_tagged_entry_get_instance_private(self),
+		(const gchar * const *) tags->pdata,
+		pinned
+	);
 
-	}
+	g_ptr_array_free(tags, true);
+	return all_added;
 
-	g_list_free(old_tags);
+}
 
-	if (changed) {
 
-		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_TAGS]);
-		gnui_tagged_entry_dispatch_modified(self, priv, true);
+gboolean gnui_tagged_entry_populate_strv (
+	GnuiTaggedEntry * const self,
+	const gchar * const * const tags,
+	const gboolean pinned
+) {
 
-	}
+	g_return_val_if_fail(GNUI_IS_TAGGED_ENTRY(self), false);
 
-	return all_added;
+	return gnui_tagged_entry_repopulate(
+		self,
+		gnui_tagged_entry_get_instance_private(self),
+		tags,
+		pinned
+	);
 
 }
 
@@ -2516,50 +3531,17 @@ extern gboolean gnui_tagged_entry_rename_tag (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
-	TagReference * tagref;
-	const GList * llnk = priv->taglist;
-
-	if (self->match_function) {
-
-		for (; llnk; llnk = llnk->next) {
+	TagReference * const tagref =
+		gnui_tagged_entry_lookup_tag(self, priv, old_name);
 
-			if (
-				self->match_function(
-					((TagReference *) llnk->data)->tag,
-					old_name,
-					self->match_data
-				)
-			) {
-
-				goto rename_and_exit;
-
-			}
-
-		}
+	if (!tagref) {
 
 		return false;
 
 	}
 
-	for (; llnk; llnk = llnk->next) {
-
-		if (!strcmp(((TagReference *) llnk->data)->tag, old_name)) {
-
-			goto rename_and_exit;
-
-		}
-
-	}
-
-	return false;
-
-
-	/* \                                  /\
-	\ */     rename_and_exit:            /* \
-	 \/     ________________________     \ */
-
-
-	tagref = llnk->data;
+	gnui_tagged_entry_unindex_tagref(self, priv, tagref);
+	gnui_tagged_entry_snapshot_remove(priv, tagref);
 	g_free(tagref->tag);
 
 	tagref->tag =
@@ -2572,7 +3554,22 @@ extern gboolean gnui_tagged_entry_rename_tag (
 		:
 			g_strdup(new_name);
 
-	gtk_label_set_text(tagref->marker, tagref->tag);
+	gnui_tagged_entry_index_tagref(self, priv, tagref);
+	gnui_tagged_entry_tag_reference_refresh(tagref);
+
+	if (self->sort_function) {
+
+		g_sequence_sort_changed(
+			tagref->iter,
+			gnui_tagged_entry_compare_tag_references,
+			self
+		);
+
+		gnui_tagged_entry_reposition_box(self, tagref);
+
+	}
+
+	gnui_tagged_entry_snapshot_insert(priv, tagref);
 	g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_TAGS]);
 	gnui_tagged_entry_dispatch_modified(self, priv, true);
 	return true;
@@ -2598,54 +3595,17 @@ gboolean gnui_tagged_entry_set_pin (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
-	const GList * llnk = priv->taglist;
-
-	if (self->match_function) {
-
-		for (; llnk; llnk = llnk->next) {
+	TagReference * const tagref =
+		gnui_tagged_entry_lookup_tag(self, priv, tag);
 
-			if (
-				self->match_function(
-					((TagReference *) llnk->data)->tag,
-					tag,
-					self->match_data
-				)
-			) {
-
-				goto set_pin_and_exit;
-
-			}
-
-		}
+	if (!tagref) {
 
 		return false;
 
 	}
 
-	for (; llnk; llnk = llnk->next) {
-
-		if (!strcmp(((TagReference *) llnk->data)->tag, tag)) {
-
-			goto set_pin_and_exit;
-
-		}
-
-	}
-
-	return false;
-
-
-	/* \                                  /\
-	\ */     set_pin_and_exit:           /* \
-	 \/     ________________________     \ */
-
-
-	gtk_widget_set_sensitive(
-		((TagReference *) llnk->data)->remover,
-		!pinned
-	);
-
-	((TagReference *) llnk->data)->pinned = pinned;
+	tagref->pinned = pinned;
+	gnui_tagged_entry_tag_reference_refresh(tagref);
 	return true;
 
 }
@@ -2662,94 +3622,37 @@ G_GNUC_NULL_TERMINATED gboolean gnui_tagged_entry_set_pins (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
+	TagReference * tagref;
 	const gchar * tag;
 	va_list args;
 	bool all_found = true;
 
 	va_start(args, pinned);
 
-	if (self->match_function) {
-
-		/* \                                  /\
-		\ */     next_tag__match:            /* \
-		 \/     ________________________     \ */
-
-
-		if ((tag = va_arg(args, const gchar *))) {
-
-			if (!*tag) {
-
-				all_found = false;
-				goto next_tag__match;
-
-			}
-
-			for (const GList * llnk = priv->taglist; llnk; llnk = llnk->next) {
-
-				if (
-					self->match_function(
-						((TagReference *) llnk->data)->tag,
-						tag,
-						self->match_data
-					)
-				) {
-
-					gtk_widget_set_sensitive(
-						((TagReference *) llnk->data)->remover,
-						!pinned
-					);
-
-					((TagReference *) llnk->data)->pinned = pinned;
-					goto next_tag__match;
-
-				}
-
-			}
-
-			all_found = false;
-			goto next_tag__match;
-
-		}
-
-		goto va_end_and_exit;
-
-	}
-
 
 	/* \                                  /\
-	\ */     next_tag__strcmp:           /* \
+	\ */     next_tag:                   /* \
 	 \/     ________________________     \ */
 
 
 	if ((tag = va_arg(args, const gchar *))) {
 
-		for (const GList * llnk = priv->taglist; llnk; llnk = llnk->next) {
-
-			if (!strcmp(((TagReference *) llnk->data)->tag, tag)) {
-
-				gtk_widget_set_sensitive(
-					((TagReference *) llnk->data)->remover,
-					!pinned
-				);
-
-				((TagReference *) llnk->data)->pinned = pinned;
-				goto next_tag__strcmp;
+		if (
+			!*tag ||
+			!(tagref = gnui_tagged_entry_lookup_tag(self, priv, tag))
+		) {
 
-			}
+			all_found = false;
+			goto next_tag;
 
 		}
 
-		all_found = false;
-		goto next_tag__strcmp;
+		tagref->pinned = pinned;
+		gnui_tagged_entry_tag_reference_refresh(tagref);
+		goto next_tag;
 
 	}
 
-
-	/* \                                  /\
-	\ */     va_end_and_exit:            /* \
-	 \/     ________________________     \ */
-
-
 	va_end(args);
 	return (gboolean) all_found;
 
@@ -2788,24 +3691,23 @@ void gnui_tagged_entry_invalidate_filter (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
-	GList * llnk = priv->taglist;
+	GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
 	TagReference * tagref;
 	bool modified = false;
 
-	while (llnk) {
-
-		tagref = llnk->data;
+	while (!g_sequence_iter_is_end(iter)) {
 
-		if (self->filter_function(self, tagref->tag, self->filter_data)) {
+		tagref = g_sequence_get(iter);
+		iter = g_sequence_iter_next(iter);
 
-			llnk = llnk->next;
-
-		} else {
+		if (!self->filter_function(self, tagref->tag, self->filter_data)) {
 
 			modified = true;
-			gnui_tagged_entry_tag_reference_destroy(self, tagref);
+			gnui_tagged_entry_unindex_tagref(self, priv, tagref);
+			gnui_tagged_entry_snapshot_remove(priv, tagref);
+			g_sequence_remove(tagref->iter);
 			priv->tag_count--;
-			GNUI_LIST_DELETE_AND_MOVE_TO_NEXT(&priv->taglist, &llnk);
+			gnui_tagged_entry_tag_reference_destroy(self, tagref);
 
 		}
 
@@ -2830,26 +3732,33 @@ void gnui_tagged_entry_invalidate_sort (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
-	TagReference * tagref;
-	GList * old_tags = g_steal_pointer(&priv->taglist), * llnk = old_tags;
+	if (!self->sort_function) {
 
-	while (llnk) {
+		return;
 
-		tagref = llnk->data;
-		g_object_ref(tagref->box);
-		gtk_widget_unparent(tagref->box);
+	}
 
-		gnui_tagged_entry_insert_llink_sorted(
-			self,
-			priv,
-			gnui_list_detach_and_move_to_next(&old_tags, &llnk)
-		);
+	g_sequence_sort(
+		priv->tag_sequence,
+		gnui_tagged_entry_compare_tag_references,
+		self
+	);
+
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) {
 
-		g_object_unref(tagref->box);
+		gtk_widget_insert_before(
+			((TagReference *) g_sequence_get(iter))->box,
+			GTK_WIDGET(self),
+			priv->textbox
+		);
 
 	}
 
-	priv->tags_have_changed = true;
+	gnui_tagged_entry_snapshot_rebuild(priv);
 
 }
 
@@ -2953,6 +3862,43 @@ void gnui_tagged_entry_set_filter_function (
 }
 
 
+GnuiTaggedEntryHashFunc gnui_tagged_entry_get_hash_function (
+	GnuiTaggedEntry * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_TAGGED_ENTRY(self), NULL);
+
+	return self->hash_function;
+
+}
+
+
+void gnui_tagged_entry_set_hash_function (
+	GnuiTaggedEntry * const self,
+	const GnuiTaggedEntryHashFunc hash_func
+) {
+
+	g_return_if_fail(GNUI_IS_TAGGED_ENTRY(self));
+
+	if (self->hash_function != hash_func) {
+
+		self->hash_function = hash_func;
+
+		gnui_tagged_entry_rebuild_index(
+			self,
+			gnui_tagged_entry_get_instance_private(self)
+		);
+
+		g_object_notify_by_pspec(
+			G_OBJECT(self),
+			props[PROPERTY_HASH_FUNCTION]
+		);
+
+	}
+
+}
+
+
 gboolean gnui_tagged_entry_get_invalid (
 	GnuiTaggedEntry * const self
 ) {
@@ -2988,6 +3934,43 @@ void gnui_tagged_entry_set_invalid (
 }
 
 
+gboolean gnui_tagged_entry_get_lightweight_tags (
+	GnuiTaggedEntry * const self
+) {
+
+	g_return_val_if_fail(GNUI_IS_TAGGED_ENTRY(self), false);
+
+	return self->lightweight_tags;
+
+}
+
+
+void gnui_tagged_entry_set_lightweight_tags (
+	GnuiTaggedEntry * const self,
+	const gboolean lightweight_tags
+) {
+
+	g_return_if_fail(GNUI_IS_TAGGED_ENTRY(self));
+
+	if (self->lightweight_tags != lightweight_tags) {
+
+		self->lightweight_tags = lightweight_tags;
+
+		gnui_tagged_entry_rebuild_tag_widgets(
+			self,
+			gnui_tagged_entry_get_instance_private(self)
+		);
+
+		g_object_notify_by_pspec(
+			G_OBJECT(self),
+			props[PROPERTY_LIGHTWEIGHT_TAGS]
+		);
+
+	}
+
+}
+
+
 gpointer gnui_tagged_entry_get_match_data (
 	GnuiTaggedEntry * const self
 ) {
@@ -3009,6 +3992,16 @@ void gnui_tagged_entry_set_match_data (
 	if (self->match_data != match_data) {
 
 		self->match_data = match_data;
+
+		if (self->hash_function) {
+
+			gnui_tagged_entry_rebuild_index(
+				self,
+				gnui_tagged_entry_get_instance_private(self)
+			);
+
+		}
+
 		g_object_notify_by_pspec(G_OBJECT(self), props[PROPERTY_MATCH_DATA]);
 
 	}
@@ -3038,6 +4031,11 @@ void gnui_tagged_entry_set_match_function (
 
 		self->match_function = match_func;
 
+		gnui_tagged_entry_rebuild_index(
+			self,
+			gnui_tagged_entry_get_instance_private(self)
+		);
+
 		g_object_notify_by_pspec(
 			G_OBJECT(self),
 			props[PROPERTY_MATCH_FUNCTION]
@@ -3252,30 +4250,54 @@ const gchar * const * gnui_tagged_entry_get_tags (
 	GnuiTaggedEntryPrivate * const priv =
 		gnui_tagged_entry_get_instance_private(self);
 
-	if (priv->tags_have_changed || !self->tags) {
-
-		g_strfreev(self->tags);
+	return
+		priv->tag_count ?
+			(const gchar * const *) priv->tag_snapshot->pdata
+		:
+			NULL;
 
-		self->tags = gnui_tagged_entry_retrieve_tags(
-			priv->taglist,
-			priv->tag_count
-		);
+}
 
-		priv->tags_have_changed = false;
 
-	}
+void gnui_tagged_entry_set_tags (
+	GnuiTaggedEntry * const self,
+	const gchar * const * const tags
+) {
 
-	return (const gchar * const *) self->tags;
+	gnui_tagged_entry_populate_strv(self, tags, false);
 
 }
 
 
-void gnui_tagged_entry_set_tags (
+void gnui_tagged_entry_foreach_tag (
 	GnuiTaggedEntry * const self,
-	const gchar * const * const tags
+	const GnuiTaggedEntryForeachFunc foreach_func,
+	const gpointer user_data
 ) {
 
-	gnui_tagged_entry_populate_strv(self, tags, false);
+	g_return_if_fail(GNUI_IS_TAGGED_ENTRY(self));
+	g_return_if_fail(foreach_func != NULL);
+
+	GnuiTaggedEntryPrivate * const priv =
+		gnui_tagged_entry_get_instance_private(self);
+
+	const TagReference * tagref;
+
+	for (
+		GSequenceIter * iter = g_sequence_get_begin_iter(priv->tag_sequence);
+			!g_sequence_iter_is_end(iter);
+		iter = g_sequence_iter_next(iter)
+	) {
+
+		tagref = g_sequence_get(iter);
+
+		if (!foreach_func(self, tagref->tag, tagref->pinned, user_data)) {
+
+			break;
+
+		}
+
+	}
 
 }
 
@@ -108,6 +108,58 @@ typedef gboolean (* GnuiTaggedEntryFilterFunc) (
 );
 
 
+/**
+
+    GnuiTaggedEntryForeachFunc:
+    @self:      (auto) (not nullable): The tagged entry
+    @tag:       (auto) (not nullable) (non-zero length) (transfer none): The
+                tag
+    @pinned:    (auto): Whether the tag is pinned
+    @user_data: (auto) (nullable) (closure): The custom data provided by the
+                user
+
+    A callback function type for `gnui_tagged_entry_foreach_tag()`
+
+    The callback must not add, remove or rename tags.
+
+    Returns:    `true` if the for-each loop must continue, `false` otherwise
+
+**/
+typedef gboolean (* GnuiTaggedEntryForeachFunc) (
+    GnuiTaggedEntry * self,
+    const gchar * tag,
+    gboolean pinned,
+    gpointer user_data
+);
+
+
+/**
+
+    GnuiTaggedEntryHashFunc:
+    @tag:       (auto) (not nullable) (non-zero length) (transfer none): The
+                string to hash
+    @user_data: (auto) (nullable) (closure): The #GnuiTaggedEntry:match-data
+                property
+
+    A function type for computing the hash of a tag consistently with the
+    #GnuiTaggedEntry:match-function property
+
+    Two strings that the match function considers matching must always have
+    the same hash.
+
+    It is granted that the strings passed to the hash function are always
+    non-`NULL` and with a length greater than zero, therefore the hash
+    function must not check for `NULL` or `""`.
+
+    Returns:    The hash of @tag
+
+**/
+typedef guint (* GnuiTaggedEntryHashFunc) (
+    const gchar * tag,
+    gpointer user_data
+);
+
+
 /**
 
     GnuiTaggedEntryMatchFunc:
@@ -220,6 +272,10 @@ extern GtkWidget * gnui_tagged_entry_new (void) G_GNUC_WARN_UNUSED_RESULT;
     #GnuiTaggedEntry:match-function property is set to `NULL` literal equality
     checks between strings will be performed in order to find the given tag.
 
+    When the tagged entry has no match function, or when it has a
+    #GnuiTaggedEntry:hash-function, the lookup takes constant time; otherwise
+    all the tags are scanned.
+
     Returns:    `true` if the tagged entry has the given tag, `false` otherwise
 
 **/
@@ -243,6 +299,10 @@ extern gboolean gnui_tagged_entry_has_tag (
     checks between strings will be performed in order to find the tag to
     remove.
 
+    When the tagged entry has no match function, or when it has a
+    #GnuiTaggedEntry:hash-function, the lookup takes constant time; otherwise
+    all the tags are scanned.
+
     Returns:    `true` if the tagged entry had the tag, `false` otherwise
 
 **/
@@ -276,6 +336,12 @@ extern void gnui_tagged_entry_remove_all_tags (
 
     Clear and populate a tagged entry
 
+    Tags that are already present keep their widgets; duplicates (according to
+    the #GnuiTaggedEntry:match-function property) are added only once. The
+    tags are sorted once and laid out in a single pass, the
+    #GnuiTaggedEntry:tags property is notified once and a single
+    #GnuiTaggedEntry::tags-added signal carries all the new tags.
+
     Returns:    `true` if all the tags were successfully added, `false`
                 otherwise
 
@@ -299,6 +365,10 @@ extern gboolean gnui_tagged_entry_populate (
 
     Clear and populate a tagged entry, using an array of strings as input
 
+    This works like `gnui_tagged_entry_populate()`: duplicates are added only
+    once, the tags are sorted once and a single #GnuiTaggedEntry::tags-added
+    signal carries all the new tags.
+
     Returns:    `true` if all the tags were successfully added, `false`
                 otherwise
 
@@ -577,6 +647,46 @@ extern void gnui_tagged_entry_set_filter_function (
 );
 
 
+/**
+
+    gnui_tagged_entry_get_hash_function: (get-property hash-function)
+    @self:      (not nullable): The tagged entry
+
+    Get the function that computes the hash of a tag
+
+    Returns:    (nullable): The hash function
+
+**/
+extern GnuiTaggedEntryHashFunc gnui_tagged_entry_get_hash_function (
+    GnuiTaggedEntry * const self
+);
+
+
+/**
+
+    gnui_tagged_entry_set_hash_function: (set-property hash-function)
+    @self:          (not nullable): The tagged entry
+    @hash_func:     (nullable): The hash function
+
+    Set the function that computes the hash of a tag
+
+    The hash function receives the #GnuiTaggedEntry:match-data property as
+    closure data and must be consistent with the
+    #GnuiTaggedEntry:match-function property: two strings that the match
+    function considers matching must always have the same hash. If no match
+    function is set the hash function must be consistent with literal
+    equality.
+
+    When @hash_func is `NULL` and a match function is set, looking up a tag
+    requires scanning all the tags; when neither is set `g_str_hash()` is used.
+
+**/
+extern void gnui_tagged_entry_set_hash_function (
+    GnuiTaggedEntry * const self,
+    const GnuiTaggedEntryHashFunc hash_func
+);
+
+
 /**
 
     gnui_tagged_entry_get_invalid: (get-property invalid)
@@ -609,6 +719,54 @@ extern void gnui_tagged_entry_set_invalid (
 );
 
 
+/**
+
+    gnui_tagged_entry_get_lightweight_tags: (get-property lightweight-tags)
+    @self:      (not nullable): The tagged entry
+
+    Get whether the tags are drawn by lightweight chips
+
+    Returns:    `true` if each tag is drawn by a single lightweight widget,
+                `false` if each tag is made of a box, a label and a button
+
+**/
+extern gboolean gnui_tagged_entry_get_lightweight_tags (
+    GnuiTaggedEntry * const self
+);
+
+
+/**
+
+    gnui_tagged_entry_set_lightweight_tags: (set-property lightweight-tags)
+    @self:              (not nullable): The tagged entry
+    @lightweight_tags:  `true` if each tag must be drawn by a single
+                        lightweight widget, `false` otherwise
+
+    Set whether the tags are drawn by lightweight chips
+
+    A lightweight chip is a single widget (with CSS name `chip` and style
+    class `tag`) that renders its tag and its remover from a cached
+    `PangoLayout`; clicks on the remover are hit-tested by the tagged entry
+    itself, and a tag is removed only when both the press and the release
+    land on the remover of the same chip. This saves a `GtkBox`, a
+    `GtkLabel`, a `GtkButton` and a signal closure per tag, which matters for
+    entries holding thousands of tags.
+
+    Lightweight chips are focusable, and pressing Delete or BackSpace on a
+    focused chip removes its tag (unless the tag is pinned). Assistive
+    technologies see each chip as a button labelled with its tag, but since
+    the remover is not a widget of its own they cannot activate it directly:
+    use the default (non-lightweight) tags if this matters.
+
+    Changing this property rebuilds the widgets of all the tags.
+
+**/
+extern void gnui_tagged_entry_set_lightweight_tags (
+    GnuiTaggedEntry * const self,
+    const gboolean lightweight_tags
+);
+
+
 /**
 
     gnui_tagged_entry_get_match_data: (get-property match-data)
@@ -687,6 +845,10 @@ extern GnuiTaggedEntryMatchFunc gnui_tagged_entry_get_match_function (
     `NULL` a literal equality check between string will be used as the match
     function.
 
+    If you set a custom match function, consider setting a consistent
+    #GnuiTaggedEntry:hash-function as well, so that tags can be looked up in
+    constant time.
+
 **/
 extern void gnui_tagged_entry_set_match_function (
     GnuiTaggedEntry * const self,
@@ -931,6 +1093,12 @@ extern void gnui_tagged_entry_set_sort_function (
 
     Get the tagged entry's tags
 
+    The returned array is a snapshot that is kept up to date as tags are added
+    or removed and that borrows the strings owned by the tagged entry, so no
+    tag is copied; it remains valid only until the tagged entry's tags change.
+    To iterate over the tags without touching the snapshot see
+    `gnui_tagged_entry_foreach_tag()`.
+
     Returns:    (transfer none) (nullable): An array of trings containing the
                 tagged entry's tags. The returned array must not be freed or
                 modified.
@@ -989,6 +1157,26 @@ extern void gnui_tagged_entry_invalidate_sort (
 );
 
 
+/**
+
+    gnui_tagged_entry_foreach_tag:
+    @self:          (not nullable): The tagged entry
+    @foreach_func:  (not nullable): A function called for each tag, in display
+                    order
+    @user_data:     (nullable) (closure): The closure to pass to @foreach_func
+
+    Call a custom function for each tag of the tagged entry
+
+    This function allocates no memory.
+
+**/
+extern void gnui_tagged_entry_foreach_tag (
+    GnuiTaggedEntry * const self,
+    const GnuiTaggedEntryForeachFunc foreach_func,
+    const gpointer user_data
+);
+
+
 /**
 
     gnui_tagged_entry_get_text_delegate:
@@ -1046,6 +1234,25 @@ typedef void (* GnuiTaggedEntrySignalHandlerTagRemoved) (
 );
 
 
+/**
+
+    GnuiTaggedEntrySignalHandlerTagsAdded:
+    @self:      (auto) (not nullable): The tagged entry
+    @tags:      (auto) (not nullable) (transfer none) (array zero-terminated=1):
+                The tags added
+    @user_data: (auto) (nullable) (closure): The custom data passed to the
+                signal
+
+    A handler function type for the #GnuiTaggedEntry::tags-added signal
+
+**/
+typedef void (* GnuiTaggedEntrySignalHandlerTagsAdded) (
+    GnuiTaggedEntry * self,
+    const gchar * const * tags,
+    gpointer user_data
+);
+
+
 /**
 
     GnuiTaggedEntrySignalHandlerActivate: